@@ -218,6 +218,10 @@ class Statement
     index() const noexcept
       { return static_cast<Index>(this->m_stor.index());  }
 
+    const S_function*
+    function_opt() const noexcept
+      { return this->m_stor.ptr<index_function>();  }
+
     bool
     is_empty_return() const noexcept
       { return (this->m_stor.index() == index_return) && this->m_stor.as<index_return>().expr.units.empty();  }
@@ -1011,7 +1011,7 @@ do_accept_for_initializer_opt(Token_Stream& tstrm)
   }
 
 Statement::S_expression&
-do_set_empty_expression(opt<Statement::S_expression>& qexpr, const Token_Stream& tstrm)
+do_set_empty_expression(opt<Statement::S_expression>& qexpr, Token_Stream& tstrm)
   {
     auto& expr = qexpr.emplace();
     expr.sloc = tstrm.next_sloc();
@@ -8,19 +8,22 @@
 #include "compiler_error.hpp"
 #include "../utils.hpp"
 namespace asteria {
-namespace {
 
-class Text_Reader
+class Token_Stream::Text_Reader
   {
   private:
     tinybuf& m_cbuf;
-    cow_string m_file;
+    Source_Location m_fsloc;
     int m_line = 0;
+    int m_start_line = 0;
 
     // current line
     size_t m_off = 0;
     cow_string m_str;
 
+    // position of an unterminated block comment
+    opt<Source_Location> m_bcomm;
+
     // string cache
     cow_dictionary<bool> m_interned_strings;
 
@@ -28,14 +31,22 @@ class Text_Reader
     explicit
     Text_Reader(tinybuf& xcbuf, stringR xfile, int xline)
       :
-        m_cbuf(xcbuf), m_file(xfile), m_line(xline)
+        m_cbuf(xcbuf), m_fsloc(xfile, 0, 0), m_line(xline), m_start_line(xline)
       {
       }
 
   public:
+    int
+    start_line() const noexcept
+      { return this->m_start_line;  }
+
+    opt<Source_Location>&
+    mut_block_comment() noexcept
+      { return this->m_bcomm;  }
+
     const cow_string&
     file() const noexcept
-      { return this->m_file;  }
+      { return this->m_fsloc.file();  }
 
     int
     line() const noexcept
@@ -48,7 +59,7 @@ class Text_Reader
     Source_Location
     tell() const noexcept
       {
-        return { this->file(), this->line(), this->column() };
+        return { this->m_fsloc, this->line(), this->column() };
       }
 
     bool
@@ -110,6 +121,10 @@ class Text_Reader
       }
   };
 
+namespace {
+
+using Text_Reader = Token_Stream::Text_Reader;
+
 template<typename XTokenT>
 bool
 do_push_token(cow_vector<Token>& tokens, Text_Reader& reader, size_t tlen, XTokenT&& xtoken)
@@ -495,11 +510,18 @@ do_accept_string_literal(cow_vector<Token>& tokens, Text_Reader& reader, char he
     if(reader.peek() != head)
       return false;
 
-    // Get a string literal.
+    // Get a string literal. Characters other than the terminator and
+    // backslashes are copied in bulk. As the line has been validated, it
+    // contains no null characters other than the terminator.
     size_t tlen = 1;
     cow_string val;
+    const char stops[] = { head, escapable ? '\\' : head, 0 };
 
     for(;;) {
+      size_t nplain = ::strcspn(reader.data(tlen), stops);
+      val.append(reader.data(tlen), nplain);
+      tlen += nplain;
+
       // Read a character.
       char next = reader.peek(tlen);
       if(next == 0)
@@ -739,29 +761,52 @@ do_accept_identifier_or_keyword(cow_vector<Token>& tokens, Text_Reader& reader,
 
 }  // namespace
 
+Token_Stream::
+Token_Stream(const Compiler_Options& opts) noexcept
+  :
+    m_opts(opts)
+  {
+  }
+
 Token_Stream::
 ~Token_Stream()
   {
   }
 
-void
+bool
 Token_Stream::
-reload(stringR file, int start_line, tinybuf&& cbuf)
+do_load_tokens(size_t offset)
   {
-    // Tokens are parsed and stored here in normal order.
-    // We will have to reverse this sequence before storing it into `*this` if
-    // it is accepted. The storage may be reused.
-    cow_vector<Token> tokens;
-    tokens.swap(this->m_rtoks);
-    tokens.clear();
-
-    // Save the position of an unterminated block comment.
-    opt<Source_Location> bcomm;
-
-    // Read source code line by line.
-    Text_Reader reader(cbuf, file, start_line);
-    while(reader.advance()) {
-      if(reader.line() == start_line) {
+    if(!this->m_reader)
+      return false;
+
+    // Discard tokens that have been consumed, except the last one.
+    if(this->m_tpos > 1) {
+      this->m_toks.erase(0, this->m_tpos - 1);
+      this->m_tpos = 1;
+    }
+
+    // Read source code line by line, until enough tokens are available.
+    auto& reader = *(this->m_reader);
+    auto& tokens = this->m_toks;
+    auto& bcomm = reader.mut_block_comment();
+
+    while(tokens.size() - this->m_tpos <= offset) {
+      if(!reader.advance()) {
+        // Fail if a block comment was not closed.
+        // A block comment may straddle multiple lines. We just mark the
+        // first line here.
+        if(bcomm)
+          throw Compiler_Error(Compiler_Error::M_format(),
+                    compiler_status_block_comment_unclosed, reader.tell(),
+                    "Block comment unclosed\n[unmatched `/*` at '$1']", *bcomm);
+
+        // There are no more tokens.
+        this->m_reader.reset();
+        return false;
+      }
+
+      if(reader.line() == reader.start_line()) {
         // Remove the UTF-8 BOM, if any.
         if(reader.starts_with("\xEF\xBB\xBF", 3))
           reader.consume(3);
@@ -777,26 +822,23 @@ reload(stringR file, int start_line, tinybuf&& cbuf)
           throw Compiler_Error(Compiler_Error::M_status(),
                     compiler_status_conflict_marker_detected, reader.tell());
 
-      // Ensure this line is a valid UTF-8 string.
-      while(reader.navail() != 0) {
-        // Decode a code point.
-        char32_t cp;
-        auto tptr = reader.data();
-        if(!utf8_decode(cp, tptr, reader.navail()))
-          throw Compiler_Error(Compiler_Error::M_status(),
-                    compiler_status_utf8_sequence_invalid, reader.tell());
-
-        // Disallow plain null characters in source data.
-        if(cp == 0)
-          throw Compiler_Error(Compiler_Error::M_status(),
-                    compiler_status_null_character_disallowed, reader.tell());
+      // Ensure this line is a valid UTF-8 string. Errors are reported at the
+      // first invalid sequence or null character, whichever comes first.
+      size_t nvalid = utf8_valid_prefix_length(reader.data(), reader.navail());
 
-        // Accept this code point.
-        reader.consume(static_cast<size_t>(tptr - reader.data()));
+      // Disallow plain null characters in source data.
+      auto tnull = static_cast<const char*>(::memchr(reader.data(), 0, nvalid));
+      if(tnull) {
+        reader.consume(static_cast<size_t>(tnull - reader.data()));
+        throw Compiler_Error(Compiler_Error::M_status(),
+                  compiler_status_null_character_disallowed, reader.tell());
       }
 
-      // Re-scan this line from the beginning.
-      reader.rewind();
+      if(nvalid != reader.navail()) {
+        reader.consume(nvalid);
+        throw Compiler_Error(Compiler_Error::M_status(),
+                  compiler_status_utf8_sequence_invalid, reader.tell());
+      }
 
       // Break this line down into tokens.
       while(reader.navail() != 0) {
@@ -846,18 +888,27 @@ reload(stringR file, int start_line, tinybuf&& cbuf)
                     compiler_status_token_character_unrecognized, reader.tell());
       }
     }
+    return true;
+  }
 
-    // Fail if a block comment was not closed.
-    // A block comment may straddle multiple lines. We just mark the
-    // first line here.
-    if(bcomm)
-      throw Compiler_Error(Compiler_Error::M_format(),
-                compiler_status_block_comment_unclosed, reader.tell(),
-                "Block comment unclosed\n[unmatched `/*` at '$1']", *bcomm);
-
-    // Reverse the token sequence and accept it.
-    ::std::reverse(tokens.mut_begin(), tokens.mut_end());
-    this->m_rtoks = ::std::move(tokens);
+void
+Token_Stream::
+clear() noexcept
+  {
+    this->m_reader.reset();
+    this->m_toks.clear();
+    this->m_tpos = 0;
+  }
+
+void
+Token_Stream::
+reload(stringR file, int start_line, tinybuf& cbuf)
+  {
+    // Tokens will be read when they are requested. The storage of the old
+    // window may be reused.
+    this->m_reader.reset(new Text_Reader(cbuf, file, start_line));
+    this->m_toks.clear();
+    this->m_tpos = 0;
   }
 
 }  // namespace asteria
@@ -11,18 +11,27 @@ namespace asteria {
 
 class Token_Stream
   {
+  public:
+    class Text_Reader;  // defined in 'token_stream.cpp'
+
   private:
     Compiler_Options m_opts;
     Recursion_Sentry m_sentry;
-    cow_vector<Token> m_rtoks;  // Tokens are stored in reverse order.
+
+    // Tokens are read on demand into a small window, which is discarded as
+    // they are consumed. The last token that has been consumed is kept, as
+    // it determines how a following sign symbol is interpreted.
+    unique_ptr<Text_Reader> m_reader;
+    cow_vector<Token> m_toks;
+    size_t m_tpos = 0;
 
   public:
-    explicit constexpr
-    Token_Stream(const Compiler_Options& opts) noexcept
-      :
-        m_opts(opts)
-      {
-      }
+    explicit
+    Token_Stream(const Compiler_Options& opts) noexcept;
+
+  private:
+    bool
+    do_load_tokens(size_t offset);
 
   public:
     ASTERIA_NONCOPYABLE_DESTRUCTOR(Token_Stream);
@@ -53,40 +62,45 @@ class Token_Stream
     set_options(const Compiler_Options& opts) noexcept
       { this->m_opts = opts;  }
 
-    // These are accessors and modifiers of tokens in this stream.
-    bool
-    empty() const noexcept
-      { return this->m_rtoks.empty();  }
-
-    size_t
-    size() const noexcept
-      { return this->m_rtoks.size();  }
-
+    // These are accessors and modifiers of tokens in this stream. As tokens
+    // are read on demand, these functions may throw `Compiler_Error`s.
     const Token*
-    peek_opt(size_t offset = 0) const noexcept
-      { return this->m_rtoks.ptr(this->m_rtoks.size() + ~offset);  }
+    peek_opt(size_t offset = 0)
+      {
+        size_t navail = this->m_toks.size() - this->m_tpos;
+        if(ROCKET_UNEXPECT(offset >= navail) && !this->do_load_tokens(offset))
+          return nullptr;
+        return this->m_toks.data() + this->m_tpos + offset;
+      }
+
+    bool
+    empty()
+      { return this->peek_opt() == nullptr;  }
 
     void
     shift(size_t count = 1) noexcept
-      { this->m_rtoks.pop_back(count);  }
+      {
+        ROCKET_ASSERT(count <= this->m_toks.size() - this->m_tpos);
+        this->m_tpos += count;
+      }
 
     void
-    clear() noexcept
-      { this->m_rtoks.clear();  }
+    clear() noexcept;
 
     Source_Location
-    next_sloc() const noexcept
+    next_sloc()
       {
-        return this->m_rtoks.empty()
-                 ? Source_Location(sref("[end]"), -1, -1)
-                 : this->m_rtoks.back().sloc();
+        // Interning a file name takes a lock, so do it only once.
+        static const Source_Location s_end_sloc(sref("[end]"), -1, -1);
+        auto qtok = this->peek_opt();
+        return qtok ? qtok->sloc() : s_end_sloc;
       }
 
-    // This function parses characters from the input stream and fills
-    // tokens into `*this`. The contents of `*this` are destroyed
-    // This function throws a `Compiler_Error` upon failure.
+    // This function prepares to parse characters from the input stream, which
+    // is borrowed, and must not be destroyed before all tokens have been
+    // consumed. The contents of `*this` are destroyed.
     void
-    reload(stringR file, int start_line, tinybuf&& cbuf);
+    reload(stringR file, int start_line, tinybuf& cbuf);
   };
 
 }  // namespace asteria
@@ -174,6 +174,7 @@ class Global_Context;
 class Garbage_Collector;
 class Random_Engine;
 class Module_Loader;
+class Regex_Cache;
 class Variadic_Arguer;
 class Instantiated_Function;
 class AIR_Node;
@@ -904,6 +905,11 @@ template<>
 struct Compiler_Options_fragment<2>
   {
     // Note: Please keep this struct as compact as possible.
+
+    // Generate code for bodies of top-level functions on up to this number of
+    // threads. Zero means the number of processors. No thread is created by
+    // default. The result does not depend on this option.
+    uint8_t compilation_threads = 1;
   };
 
 // These are aliases for historical versions.
@@ -934,6 +934,14 @@ do_hash_file(const V_string& path)
           "[`open()` failed: ${errno:full}]"),
           path);
 
+    // Hash large files in place.
+    HasherT h;
+    Mapped_File mapped(fd);
+    if(mapped) {
+      h.update(mapped.data(), mapped.size());
+      return h.finish();
+    }
+
     // Get the file mode and preferred I/O block size.
     struct ::stat stb;
     if(::fstat(fd, &stb) != 0)
@@ -942,13 +950,22 @@ do_hash_file(const V_string& path)
           "[`fstat()` failed: ${errno:full}]"),
           path);
 
-    // Allocate the I/O buffer.
-    unique_ptr<char, void (void*)> pbuf(::operator delete);
-    size_t nbuf = static_cast<size_t>(stb.st_blksize | 0x1000);
-    pbuf.reset(static_cast<char*>(::operator new(nbuf)));
+    // Files are read from the beginning to the end. This is only a hint.
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+    // Allocate the I/O buffer, which is aligned to pages. Small files are
+    // read in a single call, and large files in blocks of 1 MiB.
+    size_t nblk = static_cast<size_t>(stb.st_blksize | 0x1000);
+    size_t nbuf = static_cast<size_t>(::rocket::clamp(stb.st_size + 1, 1, 0x100000));
+    nbuf = (nbuf + nblk - 1) / nblk * nblk;
+
+    void* pmem;
+    if(::posix_memalign(&pmem, 0x1000, nbuf) != 0)
+      throw ::std::bad_alloc();
+
+    unique_ptr<char, void (void*)> pbuf(static_cast<char*>(pmem), ::free);
 
     // Read bytes from the file and hash them.
-    HasherT h;
     for(;;) {
       ::ssize_t nread = ::read(fd, pbuf, nbuf);
       if(nread <= 0) {
@@ -966,6 +983,36 @@ do_hash_file(const V_string& path)
     return h.finish();
   }
 
+template<typename HasherT>
+V_object
+do_hash_files(const V_array& paths, const optV_integer& threads)
+  {
+    cow_vector<V_string> names;
+    names.reserve(paths.size());
+    for(const auto& path : paths)
+      if(path.is_string())
+        names.push_back(path.as_string());
+      else
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Invalid path (value `$1`)"),
+            path);
+
+    // Hash files on worker threads. Results are stored by index, so no
+    // locking is needed.
+    cow_vector<decltype(::std::declval<HasherT&>().finish())> sums;
+    sums.append(names.size());
+    auto psums = sums.mut_data();
+
+    parallel_for_each(names.size(), get_thread_count(threads),
+        [&](size_t k) { psums[k] = do_hash_file<HasherT>(names[k]);  });
+
+    V_object result;
+    result.reserve(names.size());
+    for(size_t k = 0;  k != names.size();  ++k)
+      result.insert_or_assign(names[k], ::std::move(psums[k]));
+    return result;
+  }
+
 }  // namespace
 
 V_object
@@ -1012,6 +1059,12 @@ std_checksum_crc32_file(V_string path)
     return do_hash_file<CRC32_Hasher>(path);
   }
 
+V_object
+std_checksum_crc32_files(V_array paths, optV_integer threads)
+  {
+    return do_hash_files<CRC32_Hasher>(paths, threads);
+  }
+
 V_object
 std_checksum_FNV1a32()
   {
@@ -1056,6 +1109,12 @@ std_checksum_fnv1a32_file(V_string path)
     return do_hash_file<FNV1a32_Hasher>(path);
   }
 
+V_object
+std_checksum_fnv1a32_files(V_array paths, optV_integer threads)
+  {
+    return do_hash_files<FNV1a32_Hasher>(paths, threads);
+  }
+
 V_object
 std_checksum_MD5()
   {
@@ -1100,6 +1159,12 @@ std_checksum_md5_file(V_string path)
     return do_hash_file<MD5_Hasher>(path);
   }
 
+V_object
+std_checksum_md5_files(V_array paths, optV_integer threads)
+  {
+    return do_hash_files<MD5_Hasher>(paths, threads);
+  }
+
 V_object
 std_checksum_SHA1()
   {
@@ -1144,6 +1209,12 @@ std_checksum_sha1_file(V_string path)
     return do_hash_file<SHA1_Hasher>(path);
   }
 
+V_object
+std_checksum_sha1_files(V_array paths, optV_integer threads)
+  {
+    return do_hash_files<SHA1_Hasher>(paths, threads);
+  }
+
 V_object
 std_checksum_SHA224()
   {
@@ -1188,6 +1259,12 @@ std_checksum_sha224_file(V_string path)
     return do_hash_file<SHA224_Hasher>(path);
   }
 
+V_object
+std_checksum_sha224_files(V_array paths, optV_integer threads)
+  {
+    return do_hash_files<SHA224_Hasher>(paths, threads);
+  }
+
 V_object
 std_checksum_SHA256()
   {
@@ -1232,6 +1309,12 @@ std_checksum_sha256_file(V_string path)
     return do_hash_file<SHA256_Hasher>(path);
   }
 
+V_object
+std_checksum_sha256_files(V_array paths, optV_integer threads)
+  {
+    return do_hash_files<SHA256_Hasher>(paths, threads);
+  }
+
 V_object
 std_checksum_SHA384()
   {
@@ -1276,6 +1359,12 @@ std_checksum_sha384_file(V_string path)
     return do_hash_file<SHA384_Hasher>(path);
   }
 
+V_object
+std_checksum_sha384_files(V_array paths, optV_integer threads)
+  {
+    return do_hash_files<SHA384_Hasher>(paths, threads);
+  }
+
 V_object
 std_checksum_SHA512()
   {
@@ -1320,6 +1409,12 @@ std_checksum_sha512_file(V_string path)
     return do_hash_file<SHA512_Hasher>(path);
   }
 
+V_object
+std_checksum_sha512_files(V_array paths, optV_integer threads)
+  {
+    return do_hash_files<SHA512_Hasher>(paths, threads);
+  }
+
 void
 create_bindings_checksum(V_object& result, API_Version /*version*/)
   {
@@ -1365,6 +1460,23 @@ create_bindings_checksum(V_object& result, API_Version /*version*/)
         reader.throw_no_matching_function_call();
       });
 
+    result.insert_or_assign(sref("crc32_files"),
+      ASTERIA_BINDING(
+        "std.checksum.crc32_files", "paths, [threads]",
+        Argument_Reader&& reader)
+      {
+        V_array paths;
+        optV_integer threads;
+
+        reader.start_overload();
+        reader.required(paths);
+        reader.optional(threads);
+        if(reader.end_overload())
+          return (Value) std_checksum_crc32_files(paths, threads);
+
+        reader.throw_no_matching_function_call();
+      });
+
     result.insert_or_assign(sref("FNV1a32"),
       ASTERIA_BINDING(
         "std.checksum.FNV1a32", "",
@@ -1407,6 +1519,23 @@ create_bindings_checksum(V_object& result, API_Version /*version*/)
         reader.throw_no_matching_function_call();
       });
 
+    result.insert_or_assign(sref("fnv1a32_files"),
+      ASTERIA_BINDING(
+        "std.checksum.fnv1a32_files", "paths, [threads]",
+        Argument_Reader&& reader)
+      {
+        V_array paths;
+        optV_integer threads;
+
+        reader.start_overload();
+        reader.required(paths);
+        reader.optional(threads);
+        if(reader.end_overload())
+          return (Value) std_checksum_fnv1a32_files(paths, threads);
+
+        reader.throw_no_matching_function_call();
+      });
+
     result.insert_or_assign(sref("MD5"),
       ASTERIA_BINDING(
         "std.checksum.MD5", "",
@@ -1449,6 +1578,23 @@ create_bindings_checksum(V_object& result, API_Version /*version*/)
         reader.throw_no_matching_function_call();
       });
 
+    result.insert_or_assign(sref("md5_files"),
+      ASTERIA_BINDING(
+        "std.checksum.md5_files", "paths, [threads]",
+        Argument_Reader&& reader)
+      {
+        V_array paths;
+        optV_integer threads;
+
+        reader.start_overload();
+        reader.required(paths);
+        reader.optional(threads);
+        if(reader.end_overload())
+          return (Value) std_checksum_md5_files(paths, threads);
+
+        reader.throw_no_matching_function_call();
+      });
+
     result.insert_or_assign(sref("SHA1"),
       ASTERIA_BINDING(
         "std.checksum.SHA1", "",
@@ -1491,6 +1637,23 @@ create_bindings_checksum(V_object& result, API_Version /*version*/)
         reader.throw_no_matching_function_call();
       });
 
+    result.insert_or_assign(sref("sha1_files"),
+      ASTERIA_BINDING(
+        "std.checksum.sha1_files", "paths, [threads]",
+        Argument_Reader&& reader)
+      {
+        V_array paths;
+        optV_integer threads;
+
+        reader.start_overload();
+        reader.required(paths);
+        reader.optional(threads);
+        if(reader.end_overload())
+          return (Value) std_checksum_sha1_files(paths, threads);
+
+        reader.throw_no_matching_function_call();
+      });
+
     result.insert_or_assign(sref("SHA224"),
       ASTERIA_BINDING(
         "std.checksum.SHA224", "",
@@ -1533,6 +1696,23 @@ create_bindings_checksum(V_object& result, API_Version /*version*/)
         reader.throw_no_matching_function_call();
       });
 
+    result.insert_or_assign(sref("sha224_files"),
+      ASTERIA_BINDING(
+        "std.checksum.sha224_files", "paths, [threads]",
+        Argument_Reader&& reader)
+      {
+        V_array paths;
+        optV_integer threads;
+
+        reader.start_overload();
+        reader.required(paths);
+        reader.optional(threads);
+        if(reader.end_overload())
+          return (Value) std_checksum_sha224_files(paths, threads);
+
+        reader.throw_no_matching_function_call();
+      });
+
     result.insert_or_assign(sref("SHA256"),
       ASTERIA_BINDING(
         "std.checksum.SHA256", "",
@@ -1575,6 +1755,23 @@ create_bindings_checksum(V_object& result, API_Version /*version*/)
         reader.throw_no_matching_function_call();
       });
 
+    result.insert_or_assign(sref("sha256_files"),
+      ASTERIA_BINDING(
+        "std.checksum.sha256_files", "paths, [threads]",
+        Argument_Reader&& reader)
+      {
+        V_array paths;
+        optV_integer threads;
+
+        reader.start_overload();
+        reader.required(paths);
+        reader.optional(threads);
+        if(reader.end_overload())
+          return (Value) std_checksum_sha256_files(paths, threads);
+
+        reader.throw_no_matching_function_call();
+      });
+
     result.insert_or_assign(sref("SHA384"),
       ASTERIA_BINDING(
         "std.checksum.SHA384", "",
@@ -1617,6 +1814,23 @@ create_bindings_checksum(V_object& result, API_Version /*version*/)
         reader.throw_no_matching_function_call();
       });
 
+    result.insert_or_assign(sref("sha384_files"),
+      ASTERIA_BINDING(
+        "std.checksum.sha384_files", "paths, [threads]",
+        Argument_Reader&& reader)
+      {
+        V_array paths;
+        optV_integer threads;
+
+        reader.start_overload();
+        reader.required(paths);
+        reader.optional(threads);
+        if(reader.end_overload())
+          return (Value) std_checksum_sha384_files(paths, threads);
+
+        reader.throw_no_matching_function_call();
+      });
+
     result.insert_or_assign(sref("SHA512"),
       ASTERIA_BINDING(
         "std.checksum.SHA512", "",
@@ -1658,6 +1872,23 @@ create_bindings_checksum(V_object& result, API_Version /*version*/)
 
         reader.throw_no_matching_function_call();
       });
+
+    result.insert_or_assign(sref("sha512_files"),
+      ASTERIA_BINDING(
+        "std.checksum.sha512_files", "paths, [threads]",
+        Argument_Reader&& reader)
+      {
+        V_array paths;
+        optV_integer threads;
+
+        reader.start_overload();
+        reader.required(paths);
+        reader.optional(threads);
+        if(reader.end_overload())
+          return (Value) std_checksum_sha512_files(paths, threads);
+
+        reader.throw_no_matching_function_call();
+      });
   }
 
 }  // namespace asteria
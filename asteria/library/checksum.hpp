@@ -31,6 +31,10 @@ std_checksum_crc32(V_string data);
 V_integer
 std_checksum_crc32_file(V_string path);
 
+// `std.checksum.crc32_files`
+V_object
+std_checksum_crc32_files(V_array paths, optV_integer threads);
+
 // `std.checksum.FNV1a32`
 V_object
 std_checksum_FNV1a32();
@@ -55,6 +59,10 @@ std_checksum_fnv1a32(V_string data);
 V_integer
 std_checksum_fnv1a32_file(V_string path);
 
+// `std.checksum.fnv1a32_files`
+V_object
+std_checksum_fnv1a32_files(V_array paths, optV_integer threads);
+
 // `std.checksum.MD5`
 V_object
 std_checksum_MD5();
@@ -79,6 +87,10 @@ std_checksum_md5(V_string data);
 V_string
 std_checksum_md5_file(V_string path);
 
+// `std.checksum.md5_files`
+V_object
+std_checksum_md5_files(V_array paths, optV_integer threads);
+
 // `std.checksum.SHA1`
 V_object
 std_checksum_SHA1();
@@ -103,6 +115,10 @@ std_checksum_sha1(V_string data);
 V_string
 std_checksum_sha1_file(V_string path);
 
+// `std.checksum.sha1_files`
+V_object
+std_checksum_sha1_files(V_array paths, optV_integer threads);
+
 // `std.checksum.SHA224`
 V_object
 std_checksum_SHA224();
@@ -127,6 +143,10 @@ std_checksum_sha224(V_string data);
 V_string
 std_checksum_sha224_file(V_string path);
 
+// `std.checksum.sha224_files`
+V_object
+std_checksum_sha224_files(V_array paths, optV_integer threads);
+
 // `std.checksum.SHA256`
 V_object
 std_checksum_SHA256();
@@ -151,6 +171,10 @@ std_checksum_sha256(V_string data);
 V_string
 std_checksum_sha256_file(V_string path);
 
+// `std.checksum.sha256_files`
+V_object
+std_checksum_sha256_files(V_array paths, optV_integer threads);
+
 // `std.checksum.SHA384`
 V_object
 std_checksum_SHA384();
@@ -175,6 +199,10 @@ std_checksum_sha384(V_string data);
 V_string
 std_checksum_sha384_file(V_string path);
 
+// `std.checksum.sha384_files`
+V_object
+std_checksum_sha384_files(V_array paths, optV_integer threads);
+
 // `std.checksum.SHA512`
 V_object
 std_checksum_SHA512();
@@ -199,6 +227,10 @@ std_checksum_sha512(V_string data);
 V_string
 std_checksum_sha512_file(V_string path);
 
+// `std.checksum.sha512_files`
+V_object
+std_checksum_sha512_files(V_array paths, optV_integer threads);
+
 // Create an object that is to be referenced as `std.checksum`.
 void
 create_bindings_checksum(V_object& result, API_Version version);
@@ -5,6 +5,9 @@
 #include "csv.hpp"
 #include "../argument_reader.hpp"
 #include "../binding_generator.hpp"
+#include "../runtime/runtime_error.hpp"
+#include "../runtime/global_context.hpp"
+#include "../llds/reference_stack.hpp"
 #include "../utils.hpp"
 namespace asteria {
 namespace {
@@ -35,101 +38,683 @@ do_format_check_scalar(const Value& value)
     }
   }
 
-V_array
-do_csv_parse(tinybuf& buf)
-  {
-    V_array root;
-    V_string* cell = nullptr;
-    bool quote_allowed = true;
-    size_t quote_at_line = 0;
-
-    // Read source file in lines.
-    cow_string line;
-    size_t nlines = 0;
-    while(getline(line, buf)) {
-      nlines ++;
-
-      // Remove the UTF-8 BOM, if any.
-      if((nlines == 1) && line.starts_with("\xEF\xBB\xBF", 3))
-        line.erase(0, 3);
-
-      // Convert CR LF pairs to LF characters.
-      if(line.ends_with(sref("\r")))
-        line.pop_back();
-
-      // Start a new line if this is not in quotation.
-      if(quote_at_line == 0)
-        root.emplace_back(V_array());
-
-      // Parse the current line.
-      size_t offset = 0;
-      while(offset < line.size()) {
-        if(quote_at_line == 0) {
-          auto& row = root.mut_back().mut_array();
-
-          if(row.empty()) {
-            // We are not in quotation mode, so any character must start a value.
-            row.emplace_back(V_string());
-            cell = &(row.mut_back().mut_string());
-          }
+size_t
+do_csv_span(const char* str, size_t len, char a, char b, char c) noexcept
+  {
+    // Look for any of the three characters.
+    size_t off = 0;
+    const __m128i ma = _mm_set1_epi8(a);
+    const __m128i mb = _mm_set1_epi8(b);
+    const __m128i mc = _mm_set1_epi8(c);
+    while(len - off >= 16) {
+      __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + off));
+      __m128i m = _mm_or_si128(_mm_cmpeq_epi8(t, ma),
+                               _mm_or_si128(_mm_cmpeq_epi8(t, mb), _mm_cmpeq_epi8(t, mc)));
+      uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(m));
+      if(mask != 0)
+        return off + ROCKET_TZCNT32(mask);
 
-          if(quote_allowed && (line[offset] == '\"')) {
-            // Enter quotation mode to append text to `cell`.
-            offset ++;
-            quote_at_line = nlines;
-            continue;
-          }
+      off += 16;
+    }
+
+    while((off != len) && (str[off] != a) && (str[off] != b) && (str[off] != c))
+      off ++;
+    return off;
+  }
+
+enum CSV_Type : uint8_t
+  {
+    csv_type_string   = 0,
+    csv_type_integer  = 1,
+    csv_type_real     = 2,
+  };
+
+cow_vector<CSV_Type>
+do_csv_get_types(const optV_array& types)
+  {
+    cow_vector<CSV_Type> result;
+    if(!types)
+      return result;
+
+    for(const auto& type : *types)
+      if(type.is_null() || (type.is_string() && (type.as_string() == "string")))
+        result.push_back(csv_type_string);
+      else if(type.is_string() && (type.as_string() == "integer"))
+        result.push_back(csv_type_integer);
+      else if(type.is_string() && (type.as_string() == "real"))
+        result.push_back(csv_type_real);
+      else
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Invalid column type (value `$1`)"),
+            type);
+
+    return result;
+  }
+
+class CSV_Parser
+  {
+  private:
+    enum State : uint8_t
+      {
+        state_cell_start     = 0,  // at the beginning of a cell
+        state_unquoted       = 1,  // in an unquoted cell, or after a quoted one
+        state_quoted         = 2,  // in a quoted cell
+        state_quote_pending  = 3,  // after a double quote in a quoted cell
+      };
+
+    cow_vector<CSV_Type> m_types;
+    State m_state = state_cell_start;
+    bool m_bom_checked = false;
+    bool m_cr_pending = false;
+    bool m_has_cell = false;
+    size_t m_line = 1;
+    size_t m_quote_line = 0;
+    cow_string m_cell;
+    V_array m_row;
 
-          // Search for the next comma.
-          size_t epos = line.find(offset, ',');
-          if(epos == cow_string::npos) {
-            // Accept all the remaining characters.
-            cell->append(line, offset);
-            quote_allowed = true;
-            break;
+  public:
+    explicit
+    CSV_Parser(const cow_vector<CSV_Type>& types)
+      :
+        m_types(types)
+      {
+      }
+
+  public:
+    // Sets types of cells of rows that follow. This may be called from
+    // `row_func`, after a header row.
+    void
+    set_types(const cow_vector<CSV_Type>& types)
+      {
+        this->m_types = types;
+      }
+
+  private:
+    void
+    do_push_cell()
+      {
+        size_t col = this->m_row.size();
+        CSV_Type type = (col < this->m_types.size()) ? this->m_types[col] : csv_type_string;
+        if((type == csv_type_string) || this->m_cell.empty()) {
+          // Empty cells of typed columns are null.
+          if(type == csv_type_string)
+            this->m_row.emplace_back(::std::move(this->m_cell));
+          else
+            this->m_row.emplace_back(nullopt);
+
+          this->m_cell.clear();
+          return;
+        }
+
+        ::rocket::ascii_numget numg;
+        if(type == csv_type_integer) {
+          V_integer ival = 0;
+          bool valid = numg.parse_I(this->m_cell.data(), this->m_cell.size()) == this->m_cell.size();
+          if(valid) {
+            numg.cast_I(ival, INT64_MIN, INT64_MAX);
+            valid = !numg.overflowed() && !numg.underflowed();
           }
 
-          // Accept all characters between them and re-enable quotation mode.
-          cell->append(line, offset, epos - offset);
-          offset = epos + 1;
-          quote_allowed = true;
+          if(!valid)
+            ASTERIA_THROW_RUNTIME_ERROR((
+                "Invalid integer at line $1, column $2 (text `$3`)"),
+                this->m_line, col + 1, this->m_cell);
 
-          // Create a new cell after the current one.
-          row.emplace_back(V_string());
-          cell = &(row.mut_back().mut_string());
-          continue;
+          this->m_row.emplace_back(ival);
         }
+        else {
+          V_real fval;
+          if(numg.parse_D(this->m_cell.data(), this->m_cell.size()) != this->m_cell.size())
+            ASTERIA_THROW_RUNTIME_ERROR((
+                "Invalid real number at line $1, column $2 (text `$3`)"),
+                this->m_line, col + 1, this->m_cell);
 
-        // Search for the closing double quotation mark.
-        size_t epos = line.find(offset, '\"');
-        if(epos == cow_string::npos) {
-          // Accept all the remaining characters, as well as the line break.
-          cell->append(line, offset);
-          cell->push_back('\n');
-          break;
+          numg.cast_D(fval, -HUGE_VAL, HUGE_VAL);
+          this->m_row.emplace_back(fval);
         }
+        this->m_cell.clear();
+      }
 
-        size_t dpos = epos + 1;
-        if(line[dpos] == '\"') {
-          // If the quotation mark is doubled (escaped), append the first one
-          // and skip the other.
-          cell->append(line, offset, dpos - offset);
-          offset = dpos + 1;
-          continue;
+    template<typename xRowFunc>
+    void
+    do_end_row(xRowFunc&& row_func)
+      {
+        if(this->m_has_cell)
+          this->do_push_cell();
+
+        this->m_has_cell = false;
+        this->m_state = state_cell_start;
+        size_t ncols = this->m_row.size();
+        row_func(::std::move(this->m_row));
+        this->m_line ++;
+
+        // Rows usually have the same number of cells.
+        this->m_row.clear();
+        this->m_row.reserve(ncols);
+      }
+
+    void
+    do_accept_quoted(const char* str, size_t len)
+      {
+        // Line breaks are part of the cell.
+        this->m_line += static_cast<size_t>(::std::count(str, str + len, '\n'));
+        this->m_cell.append(str, len);
+      }
+
+  public:
+    // Parses a block of text, and calls `row_func` with each row that has
+    // been completed. As all states are kept in this object, a block may end
+    // anywhere, even in the middle of a cell.
+    template<typename xRowFunc>
+    void
+    feed(const char* str, size_t len, xRowFunc&& row_func)
+      {
+        size_t off = 0;
+        if(!this->m_bom_checked) {
+          // Remove the UTF-8 BOM, if any.
+          this->m_bom_checked = true;
+          if((len >= 3) && (::memcmp(str, "\xEF\xBB\xBF", 3) == 0))
+            off = 3;
+        }
+
+        if(this->m_cr_pending && (len != 0)) {
+          // A CR is removed if it precedes a LF.
+          this->m_cr_pending = false;
+          if(str[0] != '\n') {
+            this->m_has_cell = true;
+            this->m_cell.push_back('\r');
+          }
+        }
+
+        while(off < len) {
+          size_t tlen;
+          switch(this->m_state) {
+            case state_cell_start:
+              if(str[off] == '\"') {
+                // Enter quotation mode.
+                this->m_has_cell = true;
+                this->m_state = state_quoted;
+                this->m_quote_line = this->m_line;
+                off ++;
+                break;
+              }
+
+              this->m_state = state_unquoted;
+              break;
+
+            case state_unquoted:
+              // Accept all characters up to the next comma or line break.
+              tlen = do_csv_span(str + off, len - off, ',', '\n', '\r');
+              if(tlen != 0) {
+                this->m_has_cell = true;
+                this->m_cell.append(str + off, tlen);
+                off += tlen;
+              }
+
+              if(off == len)
+                break;
+
+              if(str[off] == ',') {
+                // Start a new cell after the current one.
+                this->do_push_cell();
+                this->m_has_cell = true;
+                this->m_state = state_cell_start;
+                off ++;
+              }
+              else if(str[off] == '\n') {
+                this->do_end_row(row_func);
+                off ++;
+              }
+              else if(off + 1 == len) {
+                // Check this CR against the next block.
+                this->m_cr_pending = true;
+                off ++;
+              }
+              else if(str[off + 1] == '\n')
+                off ++;
+              else {
+                this->m_has_cell = true;
+                this->m_cell.push_back('\r');
+                off ++;
+              }
+              break;
+
+            case state_quoted:
+              // Accept all characters up to the next double quote.
+              tlen = do_csv_span(str + off, len - off, '\"', '\r', '\"');
+              this->do_accept_quoted(str + off, tlen);
+              off += tlen;
+
+              if(off == len)
+                break;
+
+              if(str[off] == '\"') {
+                this->m_state = state_quote_pending;
+                off ++;
+              }
+              else if(off + 1 == len) {
+                this->m_cr_pending = true;
+                off ++;
+              }
+              else if(str[off + 1] == '\n')
+                off ++;
+              else {
+                this->m_cell.push_back('\r');
+                off ++;
+              }
+              break;
+
+            case state_quote_pending:
+              if(str[off] == '\"') {
+                // The double quote is doubled (escaped), so append only one.
+                this->m_cell.push_back('\"');
+                this->m_state = state_quoted;
+                off ++;
+                break;
+              }
+
+              // Leave quotation mode. Characters up to the next comma are
+              // still accepted.
+              this->m_state = state_unquoted;
+              break;
+
+            default:
+              ROCKET_ASSERT(false);
+          }
+        }
+      }
+
+    // Completes the last row, which may not have been terminated by a line
+    // break.
+    template<typename xRowFunc>
+    void
+    finish(xRowFunc&& row_func)
+      {
+        if(this->m_state == state_quoted)
+          ASTERIA_THROW_RUNTIME_ERROR(("Unmatched \" at line $1"), this->m_quote_line);
+
+        // A CR at the end of input is removed.
+        this->m_cr_pending = false;
+        if(this->m_has_cell)
+          this->do_end_row(row_func);
+      }
+  };
+
+template<typename xRowFunc>
+void
+do_csv_parse_file(CSV_Parser& parser, const V_string& path, xRowFunc&& row_func)
+  {
+    // Try opening the file.
+    ::rocket::unique_posix_fd fd(::open(path.safe_c_str(), O_RDONLY));
+    if(!fd)
+      ASTERIA_THROW_RUNTIME_ERROR((
+          "Could not open file '$1'",
+          "[`open()` failed: ${errno:full}]"),
+          path);
+
+    // Read and parse the file in blocks, so memory usage is bounded.
+    unique_ptr<char, void (void*)> pbuf(::operator delete);
+    const size_t nbuf = 0x100000;
+    pbuf.reset(static_cast<char*>(::operator new(nbuf)));
+
+    for(;;) {
+      ::ssize_t nread = ::read(fd, pbuf, nbuf);
+      if(nread < 0)
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Error reading file '$1'",
+            "[`read()` failed: ${errno:full}]"),
+            path);
+
+      if(nread == 0)
+        break;
+
+      parser.feed(pbuf, static_cast<size_t>(nread), row_func);
+    }
+    parser.finish(row_func);
+  }
+
+void
+do_csv_invoke(Global_Context& global, const V_function& callback, int64_t index, Value&& value)
+  {
+    // Call the function but discard its return value.
+    Reference self;
+    Reference_Stack stack;
+    stack.push().set_temporary(index);
+    stack.push().set_temporary(::std::move(value));
+    self.set_temporary(nullopt);
+    callback.invoke(self, global, ::std::move(stack));
+  }
+
+class CSV_Table final
+  :
+    public Abstract_Opaque
+  {
+  public:
+    // Each column is stored in a typed vector, and null cells are marked
+    // in a bitmap, one bit per row. The value of a null cell in the typed
+    // vector is unspecified.
+    struct Column
+      {
+        CSV_Type type;
+        cow_vector<V_integer> ints;
+        cow_vector<V_real> reals;
+        cow_vector<V_string> strs;
+        cow_vector<uint64_t> nulls;
+      };
+
+  private:
+    cow_vector<Column> m_cols;
+    cow_vector<V_string> m_names;
+    size_t m_nrows = 0;
+
+  public:
+    explicit
+    CSV_Table(const cow_vector<CSV_Type>& types)
+      {
+        this->m_cols.reserve(types.size());
+        for(CSV_Type type : types)
+          this->m_cols.emplace_back().type = type;
+      }
+
+  public:
+    tinyfmt&
+    describe(tinyfmt& fmt) const override
+      {
+        return format(fmt, "instance of `std.csv.Table` at `$1`", this);
+      }
+
+    void
+    collect_variables(Variable_HashMap&, Variable_HashMap&) const override
+      {
+      }
+
+    CSV_Table*
+    clone_opt(refcnt_ptr<Abstract_Opaque>& out) const override
+      {
+        auto ptr = new auto(*this);
+        out.reset(ptr);
+        return ptr;
+      }
+
+    size_t
+    count_rows() const noexcept
+      {
+        return this->m_nrows;
+      }
+
+    size_t
+    count_columns() const noexcept
+      {
+        return this->m_cols.size();
+      }
+
+    const cow_vector<V_string>&
+    names() const noexcept
+      {
+        return this->m_names;
+      }
+
+    const Column&
+    column(size_t col) const
+      {
+        return this->m_cols.at(col);
+      }
+
+    bool
+    is_null(size_t col, size_t row) const noexcept
+      {
+        return (this->m_cols[col].nulls[row / 64] >> (row % 64)) & 1;
+      }
+
+    void
+    set_names(V_array&& row)
+      {
+        // Names of columns that have no types are ignored.
+        this->m_names.clear();
+        for(size_t col = 0;  col != this->m_cols.size();  ++col)
+          if((col < row.size()) && row[col].is_string())
+            this->m_names.emplace_back(::std::move(row.mut(col).mut_string()));
+          else
+            this->m_names.emplace_back();
+      }
+
+    // Appends a row of values, which shall have been converted by a parser
+    // with the same types. Extra cells are ignored, and missing cells are
+    // null.
+    void
+    push_row(V_array&& row)
+      {
+        size_t bit = this->m_nrows % 64;
+        for(size_t col = 0;  col != this->m_cols.size();  ++col) {
+          auto& dst = this->m_cols.mut(col);
+          Value* src = (col < row.size()) ? &(row.mut(col)) : nullptr;
+          bool null = !src || src->is_null();
+
+          if(bit == 0)
+            dst.nulls.push_back(0);
+          if(null)
+            dst.nulls.mut_back() |= UINT64_C(1) << bit;
+
+          if(dst.type == csv_type_integer)
+            dst.ints.push_back(null ? 0 : src->as_integer());
+          else if(dst.type == csv_type_real)
+            dst.reals.push_back(null ? 0.0 : src->as_real());
+          else if(null)
+            dst.strs.emplace_back();
+          else
+            dst.strs.emplace_back(::std::move(src->mut_string()));
         }
+        this->m_nrows ++;
+      }
 
-        // Accept all characters between them and disable quotation mode.
-        cell->append(line, offset, epos - offset);
-        offset = epos + 1;
-        quote_allowed = false;
-        quote_at_line = 0;
+    // Copies rows whose indices are in `sel`, which shall be ascending.
+    void
+    gather_from(const CSV_Table& other, const cow_vector<uint32_t>& sel)
+      {
+        this->m_names = other.m_names;
+        for(size_t col = 0;  col != this->m_cols.size();  ++col) {
+          auto& dst = this->m_cols.mut(col);
+          const auto& src = other.m_cols[col];
+
+          dst.nulls.append((sel.size() + 63) / 64, 0);
+          uint64_t* nulls = dst.nulls.mut_data();
+          for(size_t k = 0;  k != sel.size();  ++k)
+            nulls[k / 64] |= ((src.nulls[sel[k] / 64] >> (sel[k] % 64)) & 1) << (k % 64);
+
+          if(dst.type == csv_type_integer) {
+            dst.ints.reserve(sel.size());
+            for(uint32_t row : sel)
+              dst.ints.push_back(src.ints[row]);
+          }
+          else if(dst.type == csv_type_real) {
+            dst.reals.reserve(sel.size());
+            for(uint32_t row : sel)
+              dst.reals.push_back(src.reals[row]);
+          }
+          else {
+            dst.strs.reserve(sel.size());
+            for(uint32_t row : sel)
+              dst.strs.push_back(src.strs[row]);
+          }
+        }
+        this->m_nrows = sel.size();
       }
+  };
+
+size_t
+do_table_column_index(const CSV_Table& table, const Value& col)
+  {
+    if(col.is_integer()) {
+      // Columns are indexed from zero.
+      if((col.as_integer() < 0) || (col.as_integer() >= static_cast<int64_t>(table.count_columns())))
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Column index out of range (index `$1`, count `$2`)"),
+            col, table.count_columns());
+
+      return static_cast<size_t>(col.as_integer());
+    }
+
+    if(col.is_string()) {
+      // Search for a column with this name.
+      const auto& names = table.names();
+      for(size_t k = 0;  k != names.size();  ++k)
+        if(names[k] == col.as_string())
+          return k;
+
+      ASTERIA_THROW_RUNTIME_ERROR((
+          "Column not found (name `$1`)"),
+          col);
+    }
+
+    ASTERIA_THROW_RUNTIME_ERROR((
+        "Invalid column (value `$1`)"),
+        col);
+  }
+
+template<typename xNumber, typename xFunc>
+void
+do_table_for_each(const xNumber* data, const uint64_t* nulls, size_t nrows, xFunc&& func)
+  {
+    // Words in the null bitmap are checked first, so whole blocks of
+    // non-null values are processed in tight loops.
+    for(size_t base = 0;  base < nrows;  base += 64) {
+      size_t end = ::std::min<size_t>(base + 64, nrows);
+      uint64_t mask = nulls[base / 64];
+      if(mask == 0)
+        for(size_t row = base;  row != end;  ++row)
+          func(data[row]);
+      else
+        for(size_t row = base;  row != end;  ++row)
+          if((mask >> (row - base) & 1) == 0)
+            func(data[row]);
     }
+  }
+
+template<typename xNumber, typename xPredicate>
+cow_vector<uint32_t>
+do_table_select(const xNumber* data, const uint64_t* nulls, size_t nrows, xPredicate&& pred)
+  {
+    cow_vector<uint32_t> sel;
+    for(size_t row = 0;  row != nrows;  ++row)
+      if((((nulls[row / 64] >> (row % 64)) & 1) == 0) && pred(data[row]))
+        sel.push_back(static_cast<uint32_t>(row));
+    return sel;
+  }
+
+void
+do_construct_Table(V_object& result, V_opaque&& value)
+  {
+    static constexpr auto s_private_uuid = sref("{35E8A1C4-6B2D-4F17-0A3C-8D51E27B94F6}");
+    result.insert_or_assign(s_private_uuid, ::std::move(value));
 
-    if(quote_at_line != 0)
-      ASTERIA_THROW_RUNTIME_ERROR(("Unmatched \" at line $1"), quote_at_line);
+    result.insert_or_assign(sref("count"),
+      ASTERIA_BINDING(
+        "std.csv.Table::count", "",
+        Reference&& self, Argument_Reader&& reader)
+      {
+        const auto& self_obj = self.dereference_readonly().as_object();
+        const auto& table = self_obj.at(s_private_uuid).as_opaque();
+
+        reader.start_overload();
+        if(reader.end_overload())
+          return (Value) std_csv_Table_count(table);
 
-    return root;
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("names"),
+      ASTERIA_BINDING(
+        "std.csv.Table::names", "",
+        Reference&& self, Argument_Reader&& reader)
+      {
+        const auto& self_obj = self.dereference_readonly().as_object();
+        const auto& table = self_obj.at(s_private_uuid).as_opaque();
+
+        reader.start_overload();
+        if(reader.end_overload())
+          return (Value) std_csv_Table_names(table);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("column"),
+      ASTERIA_BINDING(
+        "std.csv.Table::column", "col",
+        Reference&& self, Argument_Reader&& reader)
+      {
+        const auto& self_obj = self.dereference_readonly().as_object();
+        const auto& table = self_obj.at(s_private_uuid).as_opaque();
+        Value col;
+
+        reader.start_overload();
+        reader.optional(col);
+        if(reader.end_overload())
+          return (Value) std_csv_Table_column(table, col);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("stats"),
+      ASTERIA_BINDING(
+        "std.csv.Table::stats", "col",
+        Reference&& self, Argument_Reader&& reader)
+      {
+        const auto& self_obj = self.dereference_readonly().as_object();
+        const auto& table = self_obj.at(s_private_uuid).as_opaque();
+        Value col;
+
+        reader.start_overload();
+        reader.optional(col);
+        if(reader.end_overload())
+          return (Value) std_csv_Table_stats(table, col);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("filter"),
+      ASTERIA_BINDING(
+        "std.csv.Table::filter", "col, [lower], [upper]",
+        Reference&& self, Argument_Reader&& reader)
+      {
+        const auto& self_obj = self.dereference_readonly().as_object();
+        const auto& table = self_obj.at(s_private_uuid).as_opaque();
+        Value col, lower, upper;
+
+        reader.start_overload();
+        reader.optional(col);
+        reader.optional(lower);
+        reader.optional(upper);
+        if(reader.end_overload())
+          return (Value) std_csv_Table_filter(table, col, lower, upper);
+
+        reader.throw_no_matching_function_call();
+      });
+  }
+
+template<typename xParseFunc>
+V_object
+do_csv_parse_table(const V_array& types, const optV_boolean& header, xParseFunc&& parse_func)
+  {
+    auto ctypes = do_csv_get_types(types);
+    auto table = ::rocket::make_refcnt<CSV_Table>(ctypes);
+
+    // If there is a header, it contains names of columns, which are not
+    // converted.
+    bool names_pending = header && *header;
+    CSV_Parser parser(names_pending ? cow_vector<CSV_Type>() : ctypes);
+    parse_func(parser,
+        [&](V_array&& row) {
+          if(!names_pending)
+            return table->push_row(::std::move(row));
+
+          table->set_names(::std::move(row));
+          parser.set_types(ctypes);
+          names_pending = false;
+        });
+
+    V_object result;
+    do_construct_Table(result, ::std::move(table));
+    return result;
   }
 
 }  // namespace
@@ -178,28 +763,269 @@ std_csv_format(V_array value)
   }
 
 V_array
-std_csv_parse(V_string text)
+std_csv_parse(V_string text, optV_array types)
   {
-    // Parse characters from the string.
-    ::rocket::tinybuf_str cbuf;
-    cbuf.set_string(text, tinybuf::open_read);
-    return do_csv_parse(cbuf);
+    V_array rows;
+    auto add_row = [&](V_array&& row) { rows.emplace_back(::std::move(row));  };
+
+    CSV_Parser parser(do_csv_get_types(types));
+    parser.feed(text.data(), text.size(), add_row);
+    parser.finish(add_row);
+    return rows;
   }
 
 V_array
-std_csv_parse_file(V_string path)
+std_csv_parse_file(V_string path, optV_array types)
   {
-    // Try opening the file.
-    ::rocket::unique_posix_file fp(::fopen(path.safe_c_str(), "rb"));
-    if(!fp)
+    V_array rows;
+    auto add_row = [&](V_array&& row) { rows.emplace_back(::std::move(row));  };
+
+    CSV_Parser parser(do_csv_get_types(types));
+    do_csv_parse_file(parser, path, add_row);
+    return rows;
+  }
+
+V_integer
+std_csv_parse_stream(Global_Context& global, V_string path, V_function callback,
+                     optV_array types, optV_integer batch)
+  {
+    if(batch && (*batch <= 0))
       ASTERIA_THROW_RUNTIME_ERROR((
-          "Could not open file '$1'",
-          "[`fopen()` failed: ${errno:full}]"),
-          path);
+          "Batch size not valid (batch `$1`)"),
+          *batch);
+
+    CSV_Parser parser(do_csv_get_types(types));
+    int64_t count = 0;
+    if(!batch) {
+      // Pass each row to the callback.
+      do_csv_parse_file(parser, path,
+          [&](V_array&& row) {
+            do_csv_invoke(global, callback, count, ::std::move(row));
+            count ++;
+          });
+      return count;
+    }
+
+    // Collect rows, and pass them to the callback in batches.
+    V_array rows;
+    do_csv_parse_file(parser, path,
+        [&](V_array&& row) {
+          rows.emplace_back(::std::move(row));
+          count ++;
+          if(static_cast<int64_t>(rows.size()) < *batch)
+            return;
+
+          do_csv_invoke(global, callback, count - *batch, ::std::move(rows));
+          rows.clear();
+        });
+
+    if(rows.size()) {
+      int64_t index = count - static_cast<int64_t>(rows.size());
+      do_csv_invoke(global, callback, index, ::std::move(rows));
+    }
+    return count;
+  }
+
+V_object
+std_csv_parse_table(V_string text, V_array types, optV_boolean header)
+  {
+    return do_csv_parse_table(types, header,
+        [&](CSV_Parser& parser, auto&& row_func) {
+          parser.feed(text.data(), text.size(), row_func);
+          parser.finish(row_func);
+        });
+  }
+
+V_object
+std_csv_parse_table_file(V_string path, V_array types, optV_boolean header)
+  {
+    return do_csv_parse_table(types, header,
+        [&](CSV_Parser& parser, auto&& row_func) {
+          do_csv_parse_file(parser, path, row_func);
+        });
+  }
+
+V_integer
+std_csv_Table_count(const V_opaque& t)
+  {
+    return static_cast<int64_t>(t.get<CSV_Table>().count_rows());
+  }
 
-    // Parse characters from the file.
-    ::rocket::tinybuf_file cbuf(::std::move(fp));
-    return do_csv_parse(cbuf);
+optV_array
+std_csv_Table_names(const V_opaque& t)
+  {
+    const auto& table = t.get<CSV_Table>();
+    if(table.names().empty())
+      return nullopt;
+
+    V_array names;
+    names.reserve(table.names().size());
+    for(const auto& name : table.names())
+      names.emplace_back(name);
+    return names;
+  }
+
+V_array
+std_csv_Table_column(const V_opaque& t, Value col)
+  {
+    const auto& table = t.get<CSV_Table>();
+    size_t index = do_table_column_index(table, col);
+    const auto& column = table.column(index);
+
+    V_array values;
+    values.append(table.count_rows());
+    for(size_t row = 0;  row != table.count_rows();  ++row)
+      if(table.is_null(index, row))
+        continue;
+      else if(column.type == csv_type_integer)
+        values.mut(row) = column.ints[row];
+      else if(column.type == csv_type_real)
+        values.mut(row) = column.reals[row];
+      else
+        values.mut(row) = column.strs[row];
+    return values;
+  }
+
+V_object
+std_csv_Table_stats(const V_opaque& t, Value col)
+  {
+    const auto& table = t.get<CSV_Table>();
+    size_t index = do_table_column_index(table, col);
+    const auto& column = table.column(index);
+    const size_t nrows = table.count_rows();
+
+    V_object result;
+    int64_t count = 0;
+
+    if(column.type == csv_type_integer) {
+      int64_t sum = 0, min = INT64_MAX, max = INT64_MIN;
+      bool overflowed = false;
+      do_table_for_each(column.ints.data(), column.nulls.data(), nrows,
+          [&](int64_t val) {
+            overflowed |= ROCKET_ADD_OVERFLOW(sum, val, &sum);
+            min = ::std::min(min, val);
+            max = ::std::max(max, val);
+            count ++;
+          });
+
+      if(overflowed)
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Integer addition overflow in column `$1`"),
+            col);
+
+      result.try_emplace(sref("sum"), sum);
+      if(count != 0) {
+        result.try_emplace(sref("min"), min);
+        result.try_emplace(sref("max"), max);
+        result.try_emplace(sref("mean"), static_cast<double>(sum) / static_cast<double>(count));
+      }
+    }
+    else if(column.type == csv_type_real) {
+      double sum = 0, min = HUGE_VAL, max = -HUGE_VAL;
+      do_table_for_each(column.reals.data(), column.nulls.data(), nrows,
+          [&](double val) {
+            sum += val;
+            min = ::std::min(min, val);
+            max = ::std::max(max, val);
+            count ++;
+          });
+
+      result.try_emplace(sref("sum"), sum);
+      if(count != 0) {
+        result.try_emplace(sref("min"), min);
+        result.try_emplace(sref("max"), max);
+        result.try_emplace(sref("mean"), sum / static_cast<double>(count));
+      }
+    }
+    else {
+      // Strings are compared lexicographically.
+      const V_string* min = nullptr;
+      const V_string* max = nullptr;
+      do_table_for_each(column.strs.data(), column.nulls.data(), nrows,
+          [&](const V_string& val) {
+            if(!min || (val < *min))
+              min = &val;
+            if(!max || (val > *max))
+              max = &val;
+            count ++;
+          });
+
+      if(count != 0) {
+        result.try_emplace(sref("min"), *min);
+        result.try_emplace(sref("max"), *max);
+      }
+    }
+
+    result.try_emplace(sref("count"), count);
+    result.try_emplace(sref("nulls"), static_cast<int64_t>(nrows) - count);
+    return result;
+  }
+
+V_object
+std_csv_Table_filter(const V_opaque& t, Value col, Value lower, Value upper)
+  {
+    const auto& table = t.get<CSV_Table>();
+    size_t index = do_table_column_index(table, col);
+    const auto& column = table.column(index);
+    const size_t nrows = table.count_rows();
+
+    if(nrows > UINT32_MAX)
+      ASTERIA_THROW_RUNTIME_ERROR((
+          "Table too large to filter (rows `$1`)"),
+          nrows);
+
+    // Select non-null rows where the value is within `[lower,upper]`. A null
+    // bound is unbounded.
+    cow_vector<uint32_t> sel;
+    if(column.type == csv_type_string) {
+      for(const auto& bound : { &lower, &upper })
+        if(!bound->is_null() && !bound->is_string())
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Invalid bound for string column (value `$1`)"),
+              *bound);
+
+      sel = do_table_select(column.strs.data(), column.nulls.data(), nrows,
+          [&](const V_string& val) {
+            return (lower.is_null() || (val >= lower.as_string()))
+                   && (upper.is_null() || (val <= upper.as_string()));
+          });
+    }
+    else {
+      for(const auto& bound : { &lower, &upper })
+        if(!bound->is_null() && !bound->is_real())
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Invalid bound for numeric column (value `$1`)"),
+              *bound);
+
+      if((column.type == csv_type_integer) && (lower.type() != type_real) && (upper.type() != type_real)) {
+        // Compare integers exactly.
+        int64_t lo = lower.is_null() ? INT64_MIN : lower.as_integer();
+        int64_t hi = upper.is_null() ? INT64_MAX : upper.as_integer();
+        sel = do_table_select(column.ints.data(), column.nulls.data(), nrows,
+            [&](int64_t val) { return (val >= lo) && (val <= hi);  });
+      }
+      else {
+        double lo = lower.is_null() ? -HUGE_VAL : lower.as_real();
+        double hi = upper.is_null() ? HUGE_VAL : upper.as_real();
+        if(column.type == csv_type_integer)
+          sel = do_table_select(column.ints.data(), column.nulls.data(), nrows,
+              [&](int64_t val) { return (static_cast<double>(val) >= lo) && (static_cast<double>(val) <= hi);  });
+        else
+          sel = do_table_select(column.reals.data(), column.nulls.data(), nrows,
+              [&](double val) { return (val >= lo) && (val <= hi);  });
+      }
+    }
+
+    cow_vector<CSV_Type> types;
+    for(size_t k = 0;  k != table.count_columns();  ++k)
+      types.push_back(table.column(k).type);
+
+    auto filtered = ::rocket::make_refcnt<CSV_Table>(types);
+    filtered->gather_from(table, sel);
+
+    V_object result;
+    do_construct_Table(result, ::std::move(filtered));
+    return result;
   }
 
 void
@@ -222,30 +1048,93 @@ create_bindings_csv(V_object& result, API_Version /*version*/)
 
     result.insert_or_assign(sref("parse"),
       ASTERIA_BINDING(
-        "std.csv.parse", "text",
+        "std.csv.parse", "text, [types]",
         Argument_Reader&& reader)
       {
         V_string text;
+        optV_array types;
 
         reader.start_overload();
         reader.required(text);
+        reader.optional(types);
         if(reader.end_overload())
-          return (Value) std_csv_parse(text);
+          return (Value) std_csv_parse(text, types);
 
         reader.throw_no_matching_function_call();
       });
 
     result.insert_or_assign(sref("parse_file"),
       ASTERIA_BINDING(
-        "std.csv.parse_file", "path",
+        "std.csv.parse_file", "path, [types]",
+        Argument_Reader&& reader)
+      {
+        V_string path;
+        optV_array types;
+
+        reader.start_overload();
+        reader.required(path);
+        reader.optional(types);
+        if(reader.end_overload())
+          return (Value) std_csv_parse_file(path, types);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("parse_stream"),
+      ASTERIA_BINDING(
+        "std.csv.parse_stream", "path, callback, [types], [batch]",
+        Global_Context& global, Argument_Reader&& reader)
+      {
+        V_string path;
+        V_function callback;
+        optV_array types;
+        optV_integer batch;
+
+        reader.start_overload();
+        reader.required(path);
+        reader.required(callback);
+        reader.optional(types);
+        reader.optional(batch);
+        if(reader.end_overload())
+          return (Value) std_csv_parse_stream(global, path, callback, types, batch);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("parse_table"),
+      ASTERIA_BINDING(
+        "std.csv.parse_table", "text, types, [header]",
+        Argument_Reader&& reader)
+      {
+        V_string text;
+        V_array types;
+        optV_boolean header;
+
+        reader.start_overload();
+        reader.required(text);
+        reader.required(types);
+        reader.optional(header);
+        if(reader.end_overload())
+          return (Value) std_csv_parse_table(text, types, header);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("parse_table_file"),
+      ASTERIA_BINDING(
+        "std.csv.parse_table_file", "path, types, [header]",
         Argument_Reader&& reader)
       {
         V_string path;
+        V_array types;
+        optV_boolean header;
 
         reader.start_overload();
         reader.required(path);
+        reader.required(types);
+        reader.optional(header);
         if(reader.end_overload())
-          return (Value) std_csv_parse_file(path);
+          return (Value) std_csv_parse_table_file(path, types, header);
 
         reader.throw_no_matching_function_call();
       });
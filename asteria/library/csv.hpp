@@ -13,11 +13,40 @@ std_csv_format(V_array value);
 
 // `std.csv.parse`
 V_array
-std_csv_parse(V_string text);
+std_csv_parse(V_string text, optV_array types);
 
 // `std.csv.parse_file`
 V_array
-std_csv_parse_file(V_string path);
+std_csv_parse_file(V_string path, optV_array types);
+
+// `std.csv.parse_stream`
+V_integer
+std_csv_parse_stream(Global_Context& global, V_string path, V_function callback,
+                     optV_array types, optV_integer batch);
+
+// `std.csv.parse_table`
+V_object
+std_csv_parse_table(V_string text, V_array types, optV_boolean header);
+
+// `std.csv.parse_table_file`
+V_object
+std_csv_parse_table_file(V_string path, V_array types, optV_boolean header);
+
+// `std.csv.Table`
+V_integer
+std_csv_Table_count(const V_opaque& t);
+
+optV_array
+std_csv_Table_names(const V_opaque& t);
+
+V_array
+std_csv_Table_column(const V_opaque& t, Value col);
+
+V_object
+std_csv_Table_stats(const V_opaque& t, Value col);
+
+V_object
+std_csv_Table_filter(const V_opaque& t, Value col, Value lower, Value upper);
 
 // Create an object that is to be referenced as `std.csv`.
 void
@@ -422,14 +422,24 @@ std_filesystem_file_read(V_string path, optV_integer offset, optV_integer limit)
     V_string data;
     int64_t roffset = offset.value_or(0);
     int64_t rlimit = limit.value_or(INT64_MAX);
-    size_t nbatch = 0x100000;  // 1MiB
+
+    // If this is a regular file, reserve memory for all data that are to be
+    // read, so they are read in a single batch. The size is only a hint, as
+    // the file may change.
+    struct ::stat stb;
+    if((::fstat(fd, &stb) == 0) && S_ISREG(stb.st_mode) && (stb.st_size > roffset))
+      data.reserve(::rocket::clamp_cast<size_t>(::std::min(stb.st_size - roffset, rlimit), 0, INT_MAX) + 1);
 
     for(;;) {
       // Don't read too many bytes at a time.
       if(rlimit <= 0)
         break;
 
-      nbatch = ::std::min(nbatch * 2, ::rocket::clamp_cast<size_t>(rlimit, 0, INT_MAX));
+      size_t nbatch = data.capacity() - data.size();
+      if(nbatch == 0)
+        nbatch = ::std::max<size_t>(data.size(), 0x100000);  // 1MiB
+
+      nbatch = ::std::min(nbatch, ::rocket::clamp_cast<size_t>(rlimit, 0, INT_MAX));
       auto insert_pos = data.insert(data.end(), nbatch, '/');
       ::ssize_t nread;
 
@@ -13,7 +13,6 @@ namespace {
 enum IOF_Mode : uint8_t
   {
     iof_mode_input_narrow    = 0b00,
-    iof_mode_input_wide      = 0b01,
     iof_mode_output_narrow   = 0b10,
     iof_mode_output_wide     = 0b11,
   };
@@ -75,6 +74,19 @@ do_write_utf8_common(const IOF_Sentry& sentry, stringR text)
     size_t off = 0;
 
     while(off < text.size()) {
+      // ASCII characters need no decoding.
+      size_t nascii = ascii_prefix_length(text.data() + off, text.size() - off);
+      for(size_t k = off;  k != off + nascii;  ++k)
+        if(::fputwc_unlocked((wchar_t) text[k], sentry) == WEOF)
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Error writing standard output",
+              "[`fputwc_unlocked()` failed: ${errno:full}]"));
+
+      ncps += nascii;
+      off += nascii;
+      if(off == text.size())
+        break;
+
       // Decode a code point from `text`.
       char32_t cp;
       if(!utf8_decode(cp, text, off))
@@ -118,53 +130,136 @@ do_format_write_utf8_common(const IOF_Sentry& sentry, const V_string& templ, con
     return do_write_utf8_common(sentry, fmt.get_string());
   }
 
+struct IOF_Line_Buffer
+  {
+    char* data = nullptr;
+    size_t cap = 0;
+
+    explicit
+    IOF_Line_Buffer() noexcept = default;
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(IOF_Line_Buffer)
+      {
+        ::free(this->data);
+      }
+  };
+
+bool
+do_getln_common(cow_string& line, IOF_Line_Buffer& lbuf, const IOF_Sentry& sentry)
+  {
+    // `getdelim()` searches the stdio buffer for the delimiter, which is much
+    // faster than reading characters one by one.
+    ::ssize_t nread = ::getdelim(&(lbuf.data), &(lbuf.cap), '\n', sentry);
+    if(nread < 0) {
+      if(::ferror_unlocked(sentry))
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Error reading standard input",
+            "[`getdelim()` failed: ${errno:full}]"));
+
+      return false;
+    }
+
+    size_t len = static_cast<size_t>(nread);
+    if((len != 0) && (lbuf.data[len - 1] == '\n'))
+      len --;
+
+    // Validate the line as a whole.
+    size_t nvalid = utf8_valid_prefix_length(lbuf.data, len);
+    if(nvalid != len)
+      ASTERIA_THROW_RUNTIME_ERROR((
+          "Invalid UTF-8 string from standard input (byte offset `$1`)"),
+          nvalid);
+
+    line.assign(lbuf.data, len);
+    return true;
+  }
+
 }  // namespace
 
 optV_integer
 std_io_getc()
   {
-    wint_t wch;
-    const IOF_Sentry sentry(stdin, iof_mode_input_wide);
+    int ch;
+    const IOF_Sentry sentry(stdin, iof_mode_input_narrow);
 
-    wch = ::fgetwc_unlocked(sentry);
-    if((wch == WEOF) && ::ferror_unlocked(sentry))
+    ch = ::fgetc_unlocked(sentry);
+    if((ch == EOF) && ::ferror_unlocked(sentry))
       ASTERIA_THROW_RUNTIME_ERROR((
           "Error reading standard input",
-          "[`fgetwc_unlocked()` failed: ${errno:full}]"));
+          "[`fgetc_unlocked()` failed: ${errno:full}]"));
 
-    if(wch == WEOF)
+    if(ch == EOF)
       return nullopt;
 
-    return (int64_t)(uint32_t) wch;
-  }
+    if(ch < 0x80)
+      return ch;
 
-optV_string
-std_io_getln()
-  {
-    cow_string u8str;
-    wint_t wch;
-    const IOF_Sentry sentry(stdin, iof_mode_input_wide);
+    // Read trailing bytes of a multi-byte sequence. Standard input is byte-
+    // oriented, so it can be shared with `getln()` and `read()`.
+    char mbs[4] = { (char) ch };
+    size_t mblen = 1;
+    size_t mbmax = 2U + (ch >= 0xE0) + (ch >= 0xF0);
 
-    for(;;) {
-      wch = ::fgetwc_unlocked(sentry);
-      if((wch == WEOF) && ::ferror_unlocked(sentry))
+    while(mblen < mbmax) {
+      ch = ::fgetc_unlocked(sentry);
+      if((ch == EOF) && ::ferror_unlocked(sentry))
         ASTERIA_THROW_RUNTIME_ERROR((
             "Error reading standard input",
-            "[`fgetwc_unlocked()` failed: ${errno:full}]"));
+            "[`fgetc_unlocked()` failed: ${errno:full}]"));
 
-      if((wch == L'\n') || (wch == WEOF))
+      if(ch == EOF)
         break;
 
-      if(!utf8_encode(u8str, (char32_t) wch))
-        ASTERIA_THROW_RUNTIME_ERROR((
-            "Invalid UTF code point from standard input (value `$1`)"),
-            wch);
+      if((ch & 0xC0) != 0x80) {
+        ::ungetc(ch, sentry);
+        break;
+      }
+      mbs[mblen++] = (char) ch;
     }
 
-    if((wch == WEOF) && u8str.empty())
+    char32_t cp;
+    const char* mbp = mbs;
+    if(!utf8_decode(cp, mbp, mblen) || (mbp != mbs + mblen))
+      ASTERIA_THROW_RUNTIME_ERROR((
+          "Invalid UTF-8 sequence from standard input"));
+
+    return (int64_t) cp;
+  }
+
+optV_string
+std_io_getln()
+  {
+    cow_string line;
+    IOF_Line_Buffer lbuf;
+    const IOF_Sentry sentry(stdin, iof_mode_input_narrow);
+
+    if(!do_getln_common(line, lbuf, sentry))
+      return nullopt;
+
+    return ::std::move(line);
+  }
+
+optV_array
+std_io_getlns(optV_integer limit)
+  {
+    const int64_t nmax = limit.value_or(INT64_MAX);
+    if(nmax <= 0)
+      ASTERIA_THROW_RUNTIME_ERROR((
+          "Line count not valid (limit `$1`)"),
+          nmax);
+
+    V_array lines;
+    cow_string line;
+    IOF_Line_Buffer lbuf;
+    const IOF_Sentry sentry(stdin, iof_mode_input_narrow);
+
+    while((static_cast<int64_t>(lines.size()) < nmax) && do_getln_common(line, lbuf, sentry))
+      lines.emplace_back(::std::move(line));
+
+    if(lines.empty())
       return nullopt;
 
-    return ::std::move(u8str);
+    return ::std::move(lines);
   }
 
 optV_integer
@@ -326,6 +421,21 @@ create_bindings_io(V_object& result, API_Version /*version*/)
         reader.throw_no_matching_function_call();
       });
 
+    result.insert_or_assign(sref("getlns"),
+      ASTERIA_BINDING(
+        "std.io.getlns", "[limit]",
+        Argument_Reader&& reader)
+      {
+        optV_integer limit;
+
+        reader.start_overload();
+        reader.optional(limit);
+        if(reader.end_overload())
+          return (Value) std_io_getlns(limit);
+
+        reader.throw_no_matching_function_call();
+      });
+
     result.insert_or_assign(sref("putc"),
       ASTERIA_BINDING(
         "std.io.putc", "value",
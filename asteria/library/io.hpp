@@ -15,6 +15,10 @@ std_io_getc();
 optV_string
 std_io_getln();
 
+// `std.io.getlns`
+optV_array
+std_io_getlns(optV_integer limit);
+
 // `std.io.putc`
 optV_integer
 std_io_putc(V_integer value);
@@ -7,13 +7,110 @@
 #include "../binding_generator.hpp"
 #include "../runtime/runtime_error.hpp"
 #include "../runtime/global_context.hpp"
-#include "../compiler/token_stream.hpp"
+#include "../llds/reference_stack.hpp"
 #include "../compiler/compiler_error.hpp"
 #include "../compiler/enums.hpp"
 #include "../utils.hpp"
+#include <sys/stat.h>  // ::fstat()
 namespace asteria {
 namespace {
 
+class JSON_Writer
+  {
+  private:
+    // If `m_fd` is negative, all output is kept in `m_str`. Otherwise, `m_str`
+    // is a buffer which is written to `m_fd` when it is full.
+    static constexpr size_t s_block_size = 0x10000;
+
+    int m_fd = -1;
+    const cow_string* m_path = nullptr;
+    cow_string m_str;
+    int64_t m_nflushed = 0;
+
+  public:
+    explicit
+    JSON_Writer(size_t res_arg)
+      {
+        this->m_str.reserve(res_arg);
+      }
+
+    explicit
+    JSON_Writer(int fd, const cow_string& path)
+      :
+        m_fd(fd), m_path(&path)
+      {
+        this->m_str.reserve(s_block_size);
+      }
+
+    JSON_Writer(const JSON_Writer&) = delete;
+    JSON_Writer& operator=(const JSON_Writer&) = delete;
+
+  private:
+    void
+    do_write_fd(const char* data, size_t size)
+      {
+        size_t off = 0;
+        while(off != size) {
+          ::ssize_t nwrtn = ::write(this->m_fd, data + off, size - off);
+          if(nwrtn < 0)
+            ASTERIA_THROW_RUNTIME_ERROR((
+                "Error writing file '$1'",
+                "[`write()` failed: ${errno:full}]"),
+                *(this->m_path));
+
+          off += static_cast<size_t>(nwrtn);
+        }
+        this->m_nflushed += static_cast<int64_t>(size);
+      }
+
+  public:
+    int64_t
+    size() const noexcept
+      {
+        return this->m_nflushed + static_cast<int64_t>(this->m_str.size());
+      }
+
+    void
+    putc(char c)
+      {
+        if(ROCKET_UNEXPECT((this->m_fd >= 0) && (this->m_str.size() >= s_block_size)))
+          this->flush();
+
+        this->m_str.push_back(c);
+      }
+
+    void
+    putn(const char* s, size_t n)
+      {
+        if(ROCKET_UNEXPECT((this->m_fd >= 0) && (this->m_str.size() + n > s_block_size))) {
+          this->flush();
+
+          // Write long strings without copying them.
+          if(n >= s_block_size)
+            return this->do_write_fd(s, n);
+        }
+
+        this->m_str.append(s, n);
+      }
+
+    void
+    flush()
+      {
+        if(this->m_fd < 0)
+          return;
+
+        this->do_write_fd(this->m_str.data(), this->m_str.size());
+        this->m_str.clear();
+      }
+
+    cow_string
+    extract_string()
+      {
+        ROCKET_ASSERT(this->m_fd < 0);
+        return ::std::move(this->m_str);
+      }
+  };
+
 struct Indenter
   {
     virtual
@@ -21,7 +118,7 @@ struct Indenter
 
     virtual
     void
-    break_line(tinyfmt& fmt) const = 0;
+    break_line(JSON_Writer& writer) const = 0;
 
     virtual
     void
@@ -34,6 +131,10 @@ struct Indenter
     virtual
     bool
     has_indention() const noexcept = 0;
+
+    virtual
+    size_t
+    break_width(size_t level) const noexcept = 0;
   };
 
 Indenter::
@@ -51,7 +152,7 @@ class Indenter_none final
 
   public:
     void
-    break_line(tinyfmt& /*fmt*/) const override
+    break_line(JSON_Writer& /*writer*/) const override
       {
       }
 
@@ -70,6 +171,12 @@ class Indenter_none final
       {
         return false;
       }
+
+    size_t
+    break_width(size_t /*level*/) const noexcept override
+      {
+        return 0;
+      }
   };
 
 class Indenter_string final
@@ -90,9 +197,9 @@ class Indenter_string final
 
   public:
     void
-    break_line(tinyfmt& fmt) const override
+    break_line(JSON_Writer& writer) const override
       {
-        fmt << this->m_cur;
+        writer.putn(this->m_cur.data(), this->m_cur.size());
       }
 
     void
@@ -112,6 +219,12 @@ class Indenter_string final
       {
         return this->m_add.size() != 0;
       }
+
+    size_t
+    break_width(size_t level) const noexcept override
+      {
+        return 1 + level * this->m_add.size();
+      }
   };
 
 class Indenter_spaces final
@@ -132,25 +245,25 @@ class Indenter_spaces final
 
   public:
     void
-    break_line(tinyfmt& fmt) const override
+    break_line(JSON_Writer& writer) const override
       {
         static constexpr char spaces[] = "                       ";
         static constexpr size_t nspaces = ::rocket::xstrlen(spaces);
 
         // When `step` is zero, separate fields with a single space.
         if(ROCKET_EXPECT(this->m_add == 0)) {
-          fmt << spaces[0];
+          writer.putc(spaces[0]);
           return;
         }
 
         // Otherwise, terminate the current line, and indent the next.
         size_t nrem = this->m_cur;
-        fmt << '\n';
+        writer.putc('\n');
         while(ROCKET_UNEXPECT(nrem > nspaces)) {
           nrem -= nspaces;
-          fmt.putn(spaces, nspaces);
+          writer.putn(spaces, nspaces);
         }
-        fmt.putn(spaces, nrem);
+        writer.putn(spaces, nrem);
       }
 
     void
@@ -170,59 +283,95 @@ class Indenter_spaces final
       {
         return this->m_add != 0;
       }
+
+    size_t
+    break_width(size_t level) const noexcept override
+      {
+        return 1 + level * this->m_add;
+      }
   };
 
+size_t
+do_plain_ascii_length(const char* str, size_t len) noexcept
+  {
+    // Printable ASCII characters, other than double quotes and backslashes,
+    // are copied as is. As bytes are compared as signed integers, non-ASCII
+    // bytes are less than spaces.
+    size_t off = 0;
+    while(len - off >= 16) {
+      __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + off));
+      __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmplt_epi8(t, _mm_set1_epi8(' ')),
+                                            _mm_cmpeq_epi8(t, _mm_set1_epi8('\x7F'))),
+                               _mm_or_si128(_mm_cmpeq_epi8(t, _mm_set1_epi8('\"')),
+                                            _mm_cmpeq_epi8(t, _mm_set1_epi8('\\'))));
+      uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(m));
+      if(mask != 0)
+        return off + ROCKET_TZCNT32(mask);
+
+      off += 16;
+    }
+
+    while((off != len) && (static_cast<uint8_t>(str[off] - ' ') <= 0x5E)
+          && (str[off] != '\"') && (str[off] != '\\'))
+      off ++;
+    return off;
+  }
+
 void
-do_quote_string(tinyfmt& fmt, stringR str)
+do_quote_string(JSON_Writer& writer, stringR str)
   {
     // Although JavaScript uses UCS-2 rather than UTF-16, the JSON specification
     // adopts UTF-16.
-    fmt << '\"';
+    writer.putc('\"');
     size_t offset = 0;
-    while(offset < str.size()) {
+    for(;;) {
+      // Write printable characters as is.
+      size_t plen = do_plain_ascii_length(str.data() + offset, str.size() - offset);
+      writer.putn(str.data() + offset, plen);
+      offset += plen;
+      if(offset == str.size())
+        break;
+
       // Convert UTF-8 to UTF-16.
       char32_t cp;
-      if(!utf8_decode(cp, str, offset))
-        // Invalid UTF-8 code units are replaced with the replacement character.
+      if(!utf8_decode(cp, str, offset)) {
+        // Invalid UTF-8 code units are replaced with the replacement character,
+        // one for each byte.
         cp = 0xFFFD;
+        offset ++;
+      }
 
       // Escape double quotes, backslashes, and control characters.
       switch(cp) {
         case '\"':
-          fmt << "\\\"";
+          writer.putn("\\\"", 2);
           break;
 
         case '\\':
-          fmt << "\\\\";
+          writer.putn("\\\\", 2);
           break;
 
         case '\b':
-          fmt << "\\b";
+          writer.putn("\\b", 2);
           break;
 
         case '\f':
-          fmt << "\\f";
+          writer.putn("\\f", 2);
           break;
 
         case '\n':
-          fmt << "\\n";
+          writer.putn("\\n", 2);
           break;
 
         case '\r':
-          fmt << "\\r";
+          writer.putn("\\r", 2);
           break;
 
         case '\t':
-          fmt << "\\t";
+          writer.putn("\\t", 2);
           break;
 
         default: {
-          if((0x20 <= cp) && (cp <= 0x7E)) {
-            // Write printable characters as is.
-            fmt << (char) cp;
-            break;
-          }
-
           // Encode the character in UTF-16.
           char16_t ustr[2];
           char16_t* epos = ustr;
@@ -234,31 +383,31 @@ do_quote_string(tinyfmt& fmt, stringR str)
             nump.put_XU(*p, 4);
             char seq[8] = { "\\u" };
             ::std::memcpy(seq + 2, nump.data() + 2, 4);
-            fmt.putn(seq, 6);
+            writer.putn(seq, 6);
           }
           break;
         }
       }
     }
-    fmt << '\"';
+    writer.putc('\"');
   }
 
 void
-do_format_object_key(tinyfmt& fmt, bool json5, const Indenter& indent, stringR name)
+do_format_object_key(JSON_Writer& writer, bool json5, const Indenter& indent, stringR name)
   {
     // Write the key.
     if(json5 && name.size() && is_cmask(name[0], cmask_namei)
          && ::std::all_of(name.begin() + 1, name.end(),
                [](char c) { return is_cmask(c, cmask_namei | cmask_digit);  }))
-      fmt << name;
+      writer.putn(name.data(), name.size());
     else
-      do_quote_string(fmt, name);
+      do_quote_string(writer, name);
 
     // Write the colon.
     if(indent.has_indention())
-      fmt << ": ";
+      writer.putn(": ", 2);
     else
-      fmt << ':';
+      writer.putc(':');
   }
 
 bool
@@ -275,6 +424,88 @@ do_find_uncensored(V_object::const_iterator& curp, const V_object& object)
         return true;
   }
 
+size_t
+do_estimate_scalar_size(const Value& value) noexcept
+  {
+    switch(weaken_enum(value.type())) {
+      case type_boolean:
+        return 5;
+
+      case type_integer: {
+        // Count decimal digits. Large values are written in scientific
+        // notation, which are no longer than this.
+        int64_t ival = value.as_integer();
+        size_t ndigits = 1 + (ival < 0);
+        while((ival /= 10) != 0)
+          ndigits ++;
+        return ndigits;
+      }
+
+      case type_real:
+        // Most reals in real-world data are short, and are not worth the
+        // conversion.
+        return 16;
+
+      case type_string:
+        // Assume nothing needs escaping.
+        return value.as_string().size() + 2;
+
+      default:
+        return 4;
+    }
+  }
+
+size_t
+do_estimate_size(const Value& value, const Indenter& indent)
+  {
+    // This is a rough estimate of the length of output, which is only used
+    // to reserve memory, so the order in which values are visited doesn't
+    // matter. Only arrays and objects are put into the list.
+    size_t total = 0;
+    cow_vector<pair<const Value*, size_t>> pending;
+    pending.emplace_back(&value, 0);
+
+    while(pending.size()) {
+      const Value* qval = pending.back().first;
+      size_t level = pending.back().second;
+      pending.pop_back();
+
+      if(qval->is_array()) {
+        const auto& array = qval->as_array();
+        total += 2;
+        if(array.empty())
+          continue;
+
+        // Each element is followed by a comma and a line break.
+        total += (1 + indent.break_width(level + 1)) * array.size() + indent.break_width(level);
+        for(const auto& elem : array)
+          if(elem.is_array() || elem.is_object())
+            pending.emplace_back(&elem, level + 1);
+          else
+            total += do_estimate_scalar_size(elem);
+      }
+      else if(qval->is_object()) {
+        const auto& object = qval->as_object();
+        total += 2;
+        if(object.empty())
+          continue;
+
+        // Each key is quoted and followed by a colon and a space.
+        total += (5 + indent.break_width(level + 1)) * object.size() + indent.break_width(level);
+        for(const auto& r : object) {
+          total += r.first.size();
+          if(r.second.is_array() || r.second.is_object())
+            pending.emplace_back(&(r.second), level + 1);
+          else
+            total += do_estimate_scalar_size(r.second);
+        }
+      }
+      else
+        total += do_estimate_scalar_size(*qval);
+    }
+    return total;
+  }
+
 struct Xformat_array
   {
     const V_array* refa;
@@ -289,95 +520,100 @@ struct Xformat_object
 
 using Xformat = ::rocket::variant<Xformat_array, Xformat_object>;
 
-V_string
-do_format_nonrecursive(const Value& value, bool json5, Indenter& indent)
+void
+do_format_nonrecursive(JSON_Writer& writer, const Value& value, bool json5, Indenter& indent)
   {
     // Transform recursion to iteration using a handwritten stack.
-    ::rocket::tinyfmt_str fmt;
     auto qval = &value;
     cow_vector<Xformat> stack;
+    ::rocket::ascii_numput nump;
 
     // Format a value. `qval` must always point to a valid value here.
   format_next:
     switch(weaken_enum(qval->type())) {
       case type_boolean:
         // Write `true` or `false`.
-        fmt << qval->as_boolean();
+        if(qval->as_boolean())
+          writer.putn("true", 4);
+        else
+          writer.putn("false", 5);
         break;
 
       case type_integer:
         // Write the integer in decimal.
-        fmt << (double) qval->as_integer();
+        nump.put_DD((double) qval->as_integer());
+        writer.putn(nump.data(), nump.size());
         break;
 
       case type_real: {
         double real = qval->as_real();
         if(::std::isfinite(real)) {
           // Write the real in decimal.
-          fmt << real;
+          nump.put_DD(real);
+          writer.putn(nump.data(), nump.size());
         }
         else if(!json5) {
           // Censor the value.
-          fmt << "null";
+          writer.putn("null", 4);
         }
         else if(!::std::isnan(real)) {
           // JSON5 allows infinities in ECMAScript form.
-          fmt << "Infinity";
+          writer.putn("Infinity", 8);
         }
         else {
           // JSON5 allows NaNs in ECMAScript form.
-          fmt << "NaN";
+          writer.putn("NaN", 3);
         }
         break;
       }
 
       case type_string:
         // Write the quoted string.
-        do_quote_string(fmt, qval->as_string());
+        do_quote_string(writer, qval->as_string());
         break;
 
       case type_array: {
         const auto& array = qval->as_array();
-        fmt << '[';
+        writer.putc('[');
 
         Xformat_array ctxa = { &array, array.begin() };
         if(ctxa.curp != array.end()) {
           // Open an array.
           indent.increment_level();
-          indent.break_line(fmt);
+          indent.break_line(writer);
 
           qval = &*(ctxa.curp);
           stack.emplace_back(::std::move(ctxa));
           goto format_next;
         }
 
-        fmt << ']';
+        writer.putc(']');
         break;
       }
 
       case type_object: {
         const auto& object = qval->as_object();
-        fmt << '{';
+        writer.putc('{');
 
         Xformat_object ctxo = { &object, object.begin() };
         if(do_find_uncensored(ctxo.curp, object)) {
           // Open an object.
           indent.increment_level();
-          indent.break_line(fmt);
-          do_format_object_key(fmt, json5, indent, ctxo.curp->first);
+          indent.break_line(writer);
+          do_format_object_key(writer, json5, indent, ctxo.curp->first);
 
           qval = &(ctxo.curp->second);
           stack.emplace_back(::std::move(ctxo));
           goto format_next;
         }
 
-        fmt << '}';
+        writer.putc('}');
         break;
       }
 
       default:
         // Anything else is censored to `null`.
-        fmt << "null";
+        writer.putn("null", 4);
         break;
     }
 
@@ -389,8 +625,8 @@ do_format_nonrecursive(const Value& value, bool json5, Indenter& indent)
           auto& ctxa = ctx.mut<0>();
           ++ ctxa.curp;
           if(ctxa.curp != ctxa.refa->end()) {
-            fmt << ',';
-            indent.break_line(fmt);
+            writer.putc(',');
+            indent.break_line(writer);
 
             // Format the next element.
             qval = &*(ctxa.curp);
@@ -399,20 +635,20 @@ do_format_nonrecursive(const Value& value, bool json5, Indenter& indent)
 
           // Close this array.
           if(json5 && indent.has_indention())
-            fmt << ',';
+            writer.putc(',');
 
           indent.decrement_level();
-          indent.break_line(fmt);
-          fmt << ']';
+          indent.break_line(writer);
+          writer.putc(']');
           break;
         }
 
         case 1: {
           auto& ctxo = ctx.mut<1>();
           if(do_find_uncensored(++(ctxo.curp), *(ctxo.refo))) {
-            fmt << ',';
-            indent.break_line(fmt);
-            do_format_object_key(fmt, json5, indent, ctxo.curp->first);
+            writer.putc(',');
+            indent.break_line(writer);
+            do_format_object_key(writer, json5, indent, ctxo.curp->first);
 
             // Format the next value.
             qval = &(ctxo.curp->second);
@@ -421,11 +657,11 @@ do_format_nonrecursive(const Value& value, bool json5, Indenter& indent)
 
           // Close this object.
           if(json5 && indent.has_indention())
-            fmt << ',';
+            writer.putc(',');
 
           indent.decrement_level();
-          indent.break_line(fmt);
-          fmt << '}';
+          indent.break_line(writer);
+          writer.putc('}');
           break;
         }
 
@@ -435,32 +671,526 @@ do_format_nonrecursive(const Value& value, bool json5, Indenter& indent)
 
       stack.pop_back();
     }
-
-    return fmt.extract_string();
   }
 
 V_string
-do_format_nonrecursive(const Value& value, bool json5, Indenter&& indent)
+do_format_string(const Value& value, bool json5, Indenter&& indent)
+  {
+    // Reserve memory for the entire output, so it is seldom reallocated.
+    JSON_Writer writer(do_estimate_size(value, indent));
+    do_format_nonrecursive(writer, value, json5, indent);
+    return writer.extract_string();
+  }
+
+V_integer
+do_format_file(const V_string& path, const Value& value, bool json5, Indenter&& indent)
+  {
+    // Create the file, discarding its contents.
+    ::rocket::unique_posix_fd fd(::open(path.safe_c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666));
+    if(!fd)
+      ASTERIA_THROW_RUNTIME_ERROR((
+          "Could not open file '$1'",
+          "[`open()` failed: ${errno:full}]"),
+          path);
+
+    // Write the text in blocks, without building the entire string.
+    JSON_Writer writer(fd, path);
+    do_format_nonrecursive(writer, value, json5, indent);
+    writer.flush();
+    return writer.size();
+  }
+
+class JSON_Reader
+  {
+  private:
+    const char* m_bptr;
+    const char* m_eptr;
+    const char* m_cur;
+
+    // source location of `m_bptr`
+    int m_line;
+    int m_column;
+
+    // string cache for object keys
+    cow_dictionary<bool> m_interned_keys;
+
+  public:
+    explicit
+    JSON_Reader(const char* xbptr, size_t xlen, int xline = 1, int xcolumn = 1) noexcept
+      :
+        m_bptr(xbptr), m_eptr(xbptr + xlen), m_cur(xbptr),
+        m_line(xline), m_column(xcolumn)
+      {
+      }
+
+  public:
+    void
+    reset(const char* xbptr, size_t xlen, int xline, int xcolumn) noexcept
+      {
+        // Keys are retained, unless there are too many of them.
+        this->m_bptr = xbptr;
+        this->m_eptr = xbptr + xlen;
+        this->m_cur = xbptr;
+        this->m_line = xline;
+        this->m_column = xcolumn;
+
+        if(this->m_interned_keys.size() > 1000)
+          this->m_interned_keys.clear();
+      }
+
+    Source_Location
+    tell(const char* pos) const noexcept
+      {
+        // Source locations are only calculated for errors.
+        int line = this->m_line;
+        int column = this->m_column;
+        const char* lptr = this->m_bptr;
+        for(;;) {
+          auto tptr = static_cast<const char*>(::memchr(lptr, '\n', static_cast<size_t>(pos - lptr)));
+          if(!tptr)
+            break;
+
+          line += 1;
+          column = 1;
+          lptr = tptr + 1;
+        }
+        return { sref("[JSON text]"), line, column + static_cast<int>(pos - lptr) };
+      }
+
+    Source_Location
+    tell() const noexcept
+      {
+        return this->tell(this->m_cur);
+      }
+
+    size_t
+    navail() const noexcept
+      {
+        return static_cast<size_t>(this->m_eptr - this->m_cur);
+      }
+
+    const char*
+    data() const noexcept
+      {
+        return this->m_cur;
+      }
+
+    char
+    peek(size_t nadd = 0) const noexcept
+      {
+        // As null characters are not allowed in source data, a null character
+        // denotes the end of input.
+        return (nadd < this->navail()) ? this->m_cur[nadd] : '\0';
+      }
+
+    void
+    consume(size_t nadd) noexcept
+      {
+        ROCKET_ASSERT(nadd <= this->navail());
+        this->m_cur += nadd;
+      }
+
+    const phsh_string&
+    intern_key(cow_string&& val)
+      {
+        auto it = this->m_interned_keys.find(val);
+        if(it != this->m_interned_keys.end())
+          return it->first;
+
+        val.shrink_to_fit();
+        it = this->m_interned_keys.try_emplace(::std::move(val)).first;
+        return it->first;
+      }
+  };
+
+size_t
+do_space_length(const char* str, size_t len) noexcept
   {
-    return do_format_nonrecursive(value, json5, indent);
+    // Most tokens are separated by no or a single space, which don't deserve
+    // vector operations.
+    size_t off = 0;
+    while((off != len) && (off != 2)) {
+      if(!is_cmask(str[off], cmask_space))
+        return off;
+
+      off ++;
+    }
+
+    // Spaces are `[\t-\r ]`.
+    while(len - off >= 16) {
+      __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + off));
+      __m128i u = _mm_sub_epi8(t, _mm_set1_epi8('\t'));
+      __m128i m = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(u, _mm_set1_epi8('\r' - '\t')), u),
+                               _mm_cmpeq_epi8(t, _mm_set1_epi8(' ')));
+      uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(m)) ^ 0xFFFFU;
+      if(mask != 0)
+        return off + ROCKET_TZCNT32(mask);
+
+      off += 16;
+    }
+
+    while((off != len) && is_cmask(str[off], cmask_space))
+      off ++;
+    return off;
   }
 
-opt<Punctuator>
-do_accept_punctuator_opt(Token_Stream& tstrm, initializer_list<Punctuator> accept)
+size_t
+do_plain_string_length(const char* str, size_t len, char head) noexcept
   {
-    auto qtok = tstrm.peek_opt();
-    if(!qtok)
-      return nullopt;
+    // Look for the terminator, a backslash, or a line feed, which would leave
+    // the string unclosed.
+    size_t off = 0;
+    const __m128i mhead = _mm_set1_epi8(head);
+    while(len - off >= 16) {
+      __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + off));
+      __m128i m = _mm_or_si128(_mm_cmpeq_epi8(t, mhead),
+                               _mm_or_si128(_mm_cmpeq_epi8(t, _mm_set1_epi8('\\')),
+                                            _mm_cmpeq_epi8(t, _mm_set1_epi8('\n'))));
+      uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(m));
+      if(mask != 0)
+        return off + ROCKET_TZCNT32(mask);
+
+      off += 16;
+    }
 
-    if(!qtok->is_punctuator())
-      return nullopt;
+    while((off != len) && (str[off] != head) && (str[off] != '\\') && (str[off] != '\n'))
+      off ++;
+    return off;
+  }
+
+void
+do_skip_spaces_and_comments(JSON_Reader& reader)
+  {
+    for(;;) {
+      reader.consume(do_space_length(reader.data(), reader.navail()));
+      if(reader.peek() != '/')
+        return;
+
+      if(reader.peek(1) == '/') {
+        // Discard all remaining characters in this line.
+        auto tptr = static_cast<const char*>(::memchr(reader.data(), '\n', reader.navail()));
+        reader.consume(tptr ? static_cast<size_t>(tptr - reader.data()) : reader.navail());
+        continue;
+      }
+
+      if(reader.peek(1) == '*') {
+        // Search for the terminator of this block comment.
+        auto bcomm = reader.data();
+        auto tptr = static_cast<const char*>(::memmem(bcomm + 2, reader.navail() - 2, "*/", 2));
+        if(!tptr) {
+          reader.consume(reader.navail());
+          throw Compiler_Error(Compiler_Error::M_format(),
+                    compiler_status_block_comment_unclosed, reader.tell(),
+                    "Block comment unclosed\n[unmatched `/*` at '$1']", reader.tell(bcomm));
+        }
+
+        reader.consume(static_cast<size_t>(tptr + 2 - bcomm));
+        continue;
+      }
+
+      // This can't be a comment.
+      return;
+    }
+  }
+
+size_t
+do_name_length(const JSON_Reader& reader, size_t tlen)
+  {
+    size_t mlen = 0;
+    while(is_cmask(reader.peek(tlen + mlen), cmask_namei | cmask_digit))
+      mlen += 1;
+    return mlen;
+  }
+
+bool
+do_collect_digits(size_t& tlen, const JSON_Reader& reader, uint8_t mask)
+  {
+    bool has_sep = false;
+    for(;;) {
+      // Skip a digit separator.
+      char c = reader.peek(tlen);
+      if(c == '`') {
+        has_sep = true;
+        tlen += 1;
+        continue;
+      }
 
-    auto punct = qtok->as_punctuator();
-    if(::rocket::is_none_of(punct, accept))
-      return nullopt;
+      // Stop at an unwanted character.
+      if(!is_cmask(c, mask))
+        break;
 
-    tstrm.shift();
-    return punct;
+      // Collect a digit.
+      tlen += 1;
+    }
+    return has_sep;
+  }
+
+bool
+do_accept_number_opt(Value& value, JSON_Reader& reader)
+  {
+    // This follows the syntax of numeric literals of Asteria. All numbers are
+    // parsed as reals.
+    size_t tlen = 0;
+    double sign = 1;
+    bool has_sep = false;
+    uint8_t mmask = cmask_digit;
+    char expch = 'e';
+
+    // Look for an explicit sign symbol.
+    switch(reader.peek(tlen)) {
+      case '+':
+        tlen += 1;
+        break;
+
+      case '-':
+        tlen += 1;
+        sign = -1;
+        break;
+    }
+
+    switch(reader.peek(tlen)) {
+      case 'n':
+      case 'N': {
+        if(do_name_length(reader, tlen) != 3)
+          return false;
+
+        auto sptr = reader.data() + tlen;
+        if((sptr[1] != 'a') || (sptr[2] != sptr[0]))  // `nan` or `NaN`
+          return false;
+
+        value = ::std::copysign(::std::numeric_limits<V_real>::quiet_NaN(), sign);
+        reader.consume(tlen + 3);
+        return true;
+      }
+
+      case 'i':
+      case 'I': {
+        if(do_name_length(reader, tlen) != 8)
+          return false;
+
+        auto sptr = reader.data() + tlen;
+        if(::std::memcmp(sptr + 1, "nfinity", 7) != 0)  // `infinity` or `Infinity`
+          return false;
+
+        value = ::std::copysign(::std::numeric_limits<V_real>::infinity(), sign);
+        reader.consume(tlen + 8);
+        return true;
+      }
+
+      case '0':
+        tlen += 1;
+
+        // Check the radix identifier.
+        if(::rocket::is_any_of(reader.peek(tlen) | 0x20, { 'b', 'x' })) {
+          tlen += 1;
+          mmask = cmask_xdigit;
+          expch = 'p';
+        }
+
+        // Fallthrough
+      case '1':
+      case '2':
+      case '3':
+      case '4':
+      case '5':
+      case '6':
+      case '7':
+      case '8':
+      case '9':
+        break;
+
+      default:
+        return false;
+    }
+
+    // Accept the integral part, then the fractional part, then the exponent.
+    has_sep |= do_collect_digits(tlen, reader, mmask);
+
+    if(reader.peek(tlen) == '.') {
+      tlen += 1;
+      has_sep |= do_collect_digits(tlen, reader, mmask);
+    }
+
+    if((reader.peek(tlen) | 0x20) == expch) {
+      tlen += 1;
+
+      if(::rocket::is_any_of(reader.peek(tlen), { '+', '-' }))
+        tlen += 1;
+
+      has_sep |= do_collect_digits(tlen, reader, cmask_digit);
+    }
+
+    // Accept numeric suffixes, which will definitely cause errors.
+    has_sep |= do_collect_digits(tlen, reader, cmask_alpha | cmask_digit);
+
+    // Digit separators have to be removed before conversion. Otherwise the
+    // source text is converted in place.
+    const char* tptr = reader.data();
+    size_t tsize = tlen;
+    cow_string tstr;
+    if(has_sep) {
+      tstr.assign(tptr, tlen);
+      tstr.erase(::std::remove(tstr.mut_begin(), tstr.mut_end(), '`'), tstr.end());
+      tptr = tstr.data();
+      tsize = tstr.size();
+    }
+
+    ::rocket::ascii_numget numg;
+    if(numg.parse_D(tptr, tsize) != tsize)
+      throw Compiler_Error(Compiler_Error::M_status(),
+                compiler_status_numeric_literal_suffix_invalid, reader.tell());
+
+    V_real val;
+    numg.cast_D(val, -DBL_MAX, DBL_MAX);
+
+    if(numg.overflowed())
+      throw Compiler_Error(Compiler_Error::M_status(),
+                compiler_status_real_literal_overflow, reader.tell());
+
+    if(numg.underflowed())
+      throw Compiler_Error(Compiler_Error::M_status(),
+                compiler_status_real_literal_underflow, reader.tell());
+
+    value = val;
+    reader.consume(tlen);
+    return true;
+  }
+
+void
+do_accept_string(cow_string& val, JSON_Reader& reader)
+  {
+    // Both double-quoted and single-quoted strings allow escape sequences.
+    // Errors are reported at the beginning of the string.
+    const char* sptr = reader.data();
+    char head = reader.peek();
+    ROCKET_ASSERT((head == '\"') || (head == '\''));
+    reader.consume(1);
+
+    for(;;) {
+      // Copy characters that need no translation in bulk.
+      size_t nplain = do_plain_string_length(reader.data(), reader.navail(), head);
+      val.append(reader.data(), nplain);
+      reader.consume(nplain);
+
+      // Read a character.
+      char next = reader.peek();
+      if(next == head) {
+        // The end of this string is encountered. Finish.
+        reader.consume(1);
+        return;
+      }
+      else if(next != '\\')
+        throw Compiler_Error(Compiler_Error::M_status(),
+                  compiler_status_string_literal_unclosed, reader.tell(sptr));
+
+      // Translate this escape sequence.
+      next = reader.peek(1);
+      if((next == 0) || (next == '\n'))
+        throw Compiler_Error(Compiler_Error::M_status(),
+                  compiler_status_escape_sequence_incomplete, reader.tell(sptr));
+
+      reader.consume(2);
+      int xcnt = 0;
+
+      switch(next) {
+        case '\'':
+        case '\"':
+        case '\\':
+        case '?':
+        case '/':
+          val.push_back(next);
+          break;
+
+        case 'a':
+          val.push_back('\a');
+          break;
+
+        case 'b':
+          val.push_back('\b');
+          break;
+
+        case 'f':
+          val.push_back('\f');
+          break;
+
+        case 'n':
+          val.push_back('\n');
+          break;
+
+        case 'r':
+          val.push_back('\r');
+          break;
+
+        case 't':
+          val.push_back('\t');
+          break;
+
+        case 'v':
+          val.push_back('\v');
+          break;
+
+        case '0':
+          val.push_back('\0');
+          break;
+
+        case 'Z':
+          val.push_back('\x1A');
+          break;
+
+        case 'e':
+          val.push_back('\x1B');
+          break;
+
+        case 'U':
+          xcnt += 2;
+          // Fallthrough
+        case 'u':
+          xcnt += 2;
+          // Fallthrough
+        case 'x': {
+          // How many hex digits are there?
+          xcnt += 2;
+
+          // Read hex digits.
+          char32_t cp = 0;
+          for(int i = 0;  i < xcnt;  ++i) {
+            // Read a hex digit.
+            char c = reader.peek();
+            if((c == 0) || (c == '\n'))
+              throw Compiler_Error(Compiler_Error::M_status(),
+                        compiler_status_escape_sequence_incomplete, reader.tell(sptr));
+
+            if(!is_cmask(c, cmask_xdigit))
+              throw Compiler_Error(Compiler_Error::M_status(),
+                        compiler_status_escape_sequence_invalid_hex, reader.tell(sptr));
+
+            // Accumulate this digit.
+            reader.consume(1);
+            uint32_t dval = static_cast<uint8_t>(c);
+            dval |= 0x20;
+
+            cp *= 16;
+            cp += (dval <= '9') ? (dval - '0') : (dval - 'a' + 10);
+          }
+
+          if(next == 'x') {
+            // Write the character verbatim.
+            val.push_back(static_cast<char>(cp));
+          }
+          else {
+            // Write a Unicode code point.
+            if(!utf8_encode(val, cp))
+              throw Compiler_Error(Compiler_Error::M_status(),
+                        compiler_status_escape_utf_code_point_invalid, reader.tell(sptr));
+          }
+          break;
+        }
+
+        default:
+          throw Compiler_Error(Compiler_Error::M_status(),
+                    compiler_status_escape_sequence_unknown, reader.tell(sptr));
+      }
+    }
   }
 
 struct Xparse_array
@@ -472,44 +1202,44 @@ struct Xparse_object
   {
     V_object obj;
     phsh_string key;
-    Source_Location key_sloc;
+    const char* key_pos;
   };
 
 using Xparse = ::rocket::variant<Xparse_array, Xparse_object>;
 
 void
-do_accept_object_key(Xparse_object& ctxo, Token_Stream& tstrm)
+do_accept_object_key(Xparse_object& ctxo, JSON_Reader& reader)
   {
-    auto qtok = tstrm.peek_opt();
-    if(!qtok)
-      throw Compiler_Error(Compiler_Error::M_status(),
-                compiler_status_closing_brace_or_json5_key_expected, tstrm.next_sloc());
-
-    switch(weaken_enum(qtok->index())) {
-      case Token::index_identifier:
-        ctxo.key = qtok->as_identifier();
-        break;
-
-      case Token::index_string_literal:
-        ctxo.key = qtok->as_string_literal();
-        break;
-
-      default:
-        throw Compiler_Error(Compiler_Error::M_status(),
-                  compiler_status_closing_brace_or_json5_key_expected, tstrm.next_sloc());
+    do_skip_spaces_and_comments(reader);
+    ctxo.key_pos = reader.data();
+
+    char c = reader.peek();
+    if((c == '\"') || (c == '\'')) {
+      // Accept a quoted key.
+      cow_string key;
+      do_accept_string(key, reader);
+      ctxo.key = reader.intern_key(::std::move(key));
     }
+    else if(is_cmask(c, cmask_namei)) {
+      // Accept an unquoted key, which is an identifier.
+      size_t tlen = do_name_length(reader, 0);
+      ctxo.key = reader.intern_key(cow_string(reader.data(), tlen));
+      reader.consume(tlen);
+    }
+    else
+      throw Compiler_Error(Compiler_Error::M_status(),
+                compiler_status_closing_brace_or_json5_key_expected, reader.tell());
 
-    ctxo.key_sloc = qtok->sloc();
-    tstrm.shift();
-
-    auto kpunct = do_accept_punctuator_opt(tstrm, { punctuator_colon });
-    if(!kpunct)
+    do_skip_spaces_and_comments(reader);
+    if(reader.peek() != ':')
       throw Compiler_Error(Compiler_Error::M_status(),
-                compiler_status_colon_expected, tstrm.next_sloc());
+                compiler_status_colon_expected, reader.tell());
+
+    reader.consume(1);
   }
 
 Value
-do_parse_nonrecursive(Token_Stream& tstrm)
+do_parse_nonrecursive(JSON_Reader& reader)
   {
     // Implement a non-recursive descent parser.
     Value value;
@@ -517,116 +1247,93 @@ do_parse_nonrecursive(Token_Stream& tstrm)
 
     // Accept a value. No other things such as closed brackets are allowed.
   parse_next:
-    auto qtok = tstrm.peek_opt();
-    if(!qtok)
-      throw Compiler_Error(Compiler_Error::M_format(),
-                compiler_status_expression_expected, tstrm.next_sloc(),
-                "Value expected");
-
-    switch(weaken_enum(qtok->index())) {
-      case Token::index_punctuator:
-        // Accept an `[` or `{`.
-        if(qtok->as_punctuator() == punctuator_bracket_op) {
-          tstrm.shift();
-
-          auto kpunct = do_accept_punctuator_opt(tstrm, { punctuator_bracket_cl });
-          if(!kpunct) {
-            stack.emplace_back(Xparse_array());
-            goto parse_next;
-          }
+    do_skip_spaces_and_comments(reader);
+    switch(reader.peek()) {
+      case '[':
+        reader.consume(1);
+        do_skip_spaces_and_comments(reader);
+
+        if(reader.peek() != ']') {
+          stack.emplace_back(Xparse_array());
+          goto parse_next;
+        }
 
-          // Accept an empty array.
-          value = V_array();
-          break;
+        // Accept an empty array.
+        reader.consume(1);
+        value = V_array();
+        break;
+
+      case '{':
+        reader.consume(1);
+        do_skip_spaces_and_comments(reader);
+
+        if(reader.peek() != '}') {
+          stack.emplace_back(Xparse_object());
+          do_accept_object_key(stack.mut_back().mut<Xparse_object>(), reader);
+          goto parse_next;
         }
-        else if(qtok->as_punctuator() == punctuator_brace_op) {
-          tstrm.shift();
-
-          auto kpunct = do_accept_punctuator_opt(tstrm, { punctuator_brace_cl });
-          if(!kpunct) {
-            stack.emplace_back(Xparse_object());
-            do_accept_object_key(stack.mut_back().mut<Xparse_object>(), tstrm);
-            goto parse_next;
-          }
 
-          // Accept an empty object.
-          value = V_object();
+        // Accept an empty object.
+        reader.consume(1);
+        value = V_object();
+        break;
+
+      case '\"':
+      case '\'': {
+        // Accept a UTF-8 string.
+        V_string str;
+        do_accept_string(str, reader);
+        value = ::std::move(str);
+        break;
+      }
+
+      default: {
+        // Accept a number.
+        if(do_accept_number_opt(value, reader))
           break;
-        }
-        else
-          throw Compiler_Error(Compiler_Error::M_format(),
-                    compiler_status_expression_expected, tstrm.next_sloc(),
-                    "Value expected");
 
-      case Token::index_identifier:
         // Accept a literal.
-        if(qtok->as_identifier() == "null") {
-          tstrm.shift();
+        size_t tlen = do_name_length(reader, 0);
+        if((tlen == 4) && (::std::memcmp(reader.data(), "null", 4) == 0))
           value = nullopt;
-          break;
-        }
-        else if(qtok->as_identifier() == "true") {
-          tstrm.shift();
+        else if((tlen == 4) && (::std::memcmp(reader.data(), "true", 4) == 0))
           value = true;
-          break;
-        }
-        else if(qtok->as_identifier() == "false") {
-          tstrm.shift();
+        else if((tlen == 5) && (::std::memcmp(reader.data(), "false", 5) == 0))
           value = false;
-          break;
-        }
-        else if(qtok->as_identifier() == "Infinity") {
-          tstrm.shift();
-          value = ::std::numeric_limits<double>::infinity();
-          break;
-        }
-        else if(qtok->as_identifier() == "NaN") {
-          tstrm.shift();
-          value = ::std::numeric_limits<double>::quiet_NaN();
-          break;
-        }
         else
           throw Compiler_Error(Compiler_Error::M_format(),
-                    compiler_status_expression_expected, tstrm.next_sloc(),
+                    compiler_status_expression_expected, reader.tell(),
                     "Value expected");
 
-      case Token::index_real_literal:
-        // Accept a number.
-        value = qtok->as_real_literal();
-        tstrm.shift();
-        break;
-
-      case Token::index_string_literal:
-        // Accept a UTF-8 string.
-        value = qtok->as_string_literal();
-        tstrm.shift();
+        reader.consume(tlen);
         break;
-
-      default:
-        throw Compiler_Error(Compiler_Error::M_format(),
-                  compiler_status_expression_expected, tstrm.next_sloc(),
-                  "Value expected");
+      }
     }
 
     while(stack.size()) {
       // Advance to the next element.
       auto& ctx = stack.mut_back();
+      do_skip_spaces_and_comments(reader);
+
       switch(ctx.index()) {
         case 0: {
           auto& ctxa = ctx.mut<Xparse_array>();
           ctxa.arr.emplace_back(::std::move(value));
 
           // Look for the next element.
-          auto kpunct = do_accept_punctuator_opt(tstrm, { punctuator_bracket_cl, punctuator_comma });
-          if(!kpunct)
+          char next = reader.peek();
+          if((next != ']') && (next != ','))
             throw Compiler_Error(Compiler_Error::M_status(),
-                      compiler_status_closing_bracket_or_comma_expected, tstrm.next_sloc());
+                      compiler_status_closing_bracket_or_comma_expected, reader.tell());
 
-          if(*kpunct == punctuator_comma) {
+          reader.consume(1);
+          if(next == ',') {
             // A closing bracket may still follow.
-            kpunct = do_accept_punctuator_opt(tstrm, { punctuator_bracket_cl });
-            if(!kpunct)
+            do_skip_spaces_and_comments(reader);
+            if(reader.peek() != ']')
               goto parse_next;
+
+            reader.consume(1);
           }
 
           // Close this array.
@@ -639,21 +1346,24 @@ do_parse_nonrecursive(Token_Stream& tstrm)
           auto pair = ctxo.obj.try_emplace(::std::move(ctxo.key), ::std::move(value));
           if(!pair.second)
             throw Compiler_Error(Compiler_Error::M_status(),
-                      compiler_status_duplicate_key_in_object, ctxo.key_sloc);
+                      compiler_status_duplicate_key_in_object, reader.tell(ctxo.key_pos));
 
           // Look for the next element.
-          auto kpunct = do_accept_punctuator_opt(tstrm, { punctuator_brace_cl, punctuator_comma });
-          if(!kpunct)
+          char next = reader.peek();
+          if((next != '}') && (next != ','))
             throw Compiler_Error(Compiler_Error::M_status(),
-                      compiler_status_closing_brace_or_comma_expected, tstrm.next_sloc());
+                      compiler_status_closing_brace_or_comma_expected, reader.tell());
 
-          if(*kpunct == punctuator_comma) {
+          reader.consume(1);
+          if(next == ',') {
             // A closing brace may still follow.
-            kpunct = do_accept_punctuator_opt(tstrm, { punctuator_brace_cl });
-            if(!kpunct) {
-              do_accept_object_key(stack.mut_back().mut<Xparse_object>(), tstrm);
+            do_skip_spaces_and_comments(reader);
+            if(reader.peek() != '}') {
+              do_accept_object_key(ctxo, reader);
               goto parse_next;
             }
+
+            reader.consume(1);
           }
 
           // Close this object.
@@ -671,29 +1381,351 @@ do_parse_nonrecursive(Token_Stream& tstrm)
     return value;
   }
 
+void
+do_validate_text(const JSON_Reader& reader)
+  {
+    // Validate the text in bulk. Null characters are not allowed.
+    size_t nvalid = utf8_valid_prefix_length(reader.data(), reader.navail());
+
+    auto tnull = static_cast<const char*>(::memchr(reader.data(), 0, nvalid));
+    if(tnull)
+      throw Compiler_Error(Compiler_Error::M_status(),
+                compiler_status_null_character_disallowed, reader.tell(tnull));
+
+    if(nvalid != reader.navail())
+      throw Compiler_Error(Compiler_Error::M_status(),
+                compiler_status_utf8_sequence_invalid, reader.tell(reader.data() + nvalid));
+  }
+
 Value
-do_parse(tinybuf& cbuf)
-  {
-    // We reuse the lexer of Asteria here, allowing quite a few extensions e.g. binary numeric
-    // literals and comments.
-    Compiler_Options opts;
-    opts.escapable_single_quotes = true;
-    opts.keywords_as_identifiers = true;
-    opts.integers_as_reals = true;
-
-    Token_Stream tstrm(opts);
-    tstrm.reload(sref("[JSON text]"), 1, ::std::move(cbuf));
-    if(tstrm.empty())
+do_parse(const char* str, size_t len)
+  {
+    JSON_Reader reader(str, len);
+    do_validate_text(reader);
+
+    // Remove the UTF-8 BOM, if any.
+    if((len >= 3) && (::std::memcmp(str, "\xEF\xBB\xBF", 3) == 0))
+      reader.consume(3);
+
+    do_skip_spaces_and_comments(reader);
+    if(reader.navail() == 0)
       ASTERIA_THROW_RUNTIME_ERROR(("Empty JSON string"));
 
     // Parse a single value.
-    auto value = do_parse_nonrecursive(tstrm);
-    if(!tstrm.empty())
+    auto value = do_parse_nonrecursive(reader);
+    do_skip_spaces_and_comments(reader);
+    if(reader.navail() != 0)
       ASTERIA_THROW_RUNTIME_ERROR(("Excess text at end of JSON string"));
 
     return value;
   }
 
+// Streaming parser
+// Text is read in blocks into a window. Before a value is parsed, its end is
+// located with a scanner which reads more text as needed, so the parser above
+// always sees complete values. Text that has been consumed is discarded, so
+// the window never grows much larger than the largest value.
+class JSON_Stream
+  {
+  private:
+    ::rocket::unique_posix_fd m_fd;
+    cow_string m_path;
+    bool m_eof = false;
+
+    // unconsumed text, and the source location of its beginning
+    cow_string m_buf;
+    size_t m_off = 0;
+    int m_line = 1;
+    int m_column = 1;
+
+  public:
+    explicit
+    JSON_Stream(stringR xpath)
+      :
+        m_fd(::open(xpath.safe_c_str(), O_RDONLY)), m_path(xpath)
+      {
+        if(!this->m_fd)
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Could not open file '$1'",
+              "[`open()` failed: ${errno:full}]"),
+              this->m_path);
+      }
+
+  public:
+    const char*
+    begin() const noexcept
+      { return this->m_buf.data() + this->m_off;  }
+
+    const char*
+    end() const noexcept
+      { return this->m_buf.data() + this->m_buf.size();  }
+
+    int
+    line() const noexcept
+      { return this->m_line;  }
+
+    int
+    column() const noexcept
+      { return this->m_column;  }
+
+    void
+    consume_to(const char* pos) noexcept
+      {
+        ROCKET_ASSERT(pos >= this->begin());
+        ROCKET_ASSERT(pos <= this->end());
+
+        // Keep track of the source location.
+        const char* lptr = this->begin();
+        for(;;) {
+          auto tptr = static_cast<const char*>(::memchr(lptr, '\n', static_cast<size_t>(pos - lptr)));
+          if(!tptr)
+            break;
+
+          this->m_line += 1;
+          this->m_column = 1;
+          lptr = tptr + 1;
+        }
+        this->m_column += static_cast<int>(pos - lptr);
+        this->m_off = static_cast<size_t>(pos - this->m_buf.data());
+      }
+
+    bool
+    fill()
+      {
+        // Discard consumed text. All pointers into the window are invalidated.
+        if(this->m_eof)
+          return false;
+
+        this->m_buf.erase(0, this->m_off);
+        this->m_off = 0;
+
+        // Read at least as many bytes as there are in the window, so a long
+        // value is scanned for an amortized linear number of times.
+        size_t nbatch = ::std::max<size_t>(this->m_buf.size(), 0x100000);
+        size_t nold = this->m_buf.size();
+        this->m_buf.append(nbatch, '/');
+        ::ssize_t nread = ::read(this->m_fd, this->m_buf.mut_data() + nold, nbatch);
+        if(nread < 0)
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Error reading file '$1'",
+              "[`read()` failed: ${errno:full}]"),
+              this->m_path);
+
+        this->m_buf.erase(nold + static_cast<size_t>(nread));
+        this->m_eof = nread == 0;
+        return !this->m_eof;
+      }
+  };
+
+Source_Location
+do_stream_tell(const JSON_Stream& strm)
+  {
+    return { sref("[JSON text]"), strm.line(), strm.column() };
+  }
+
+bool
+do_skip_spaces_partial(const char*& pos, const char* end)
+  {
+    // Skip spaces and complete comments. If a non-space character is found,
+    // `true` is returned. If more text is needed, `false` is returned.
+    for(;;) {
+      pos += do_space_length(pos, static_cast<size_t>(end - pos));
+      if((pos == end) || ((pos[0] == '/') && (end - pos < 2)))
+        return false;
+
+      if((pos[0] != '/') || ((pos[1] != '/') && (pos[1] != '*')))
+        return true;
+
+      auto tptr = (pos[1] == '/')
+                    ? static_cast<const char*>(::memchr(pos, '\n', static_cast<size_t>(end - pos)))
+                    : static_cast<const char*>(::memmem(pos + 2, static_cast<size_t>(end - pos - 2), "*/", 2));
+      if(!tptr)
+        return false;
+
+      pos = tptr + ((pos[1] == '/') ? 0 : 2);
+    }
+  }
+
+const char*
+do_skip_string_opt(const char* pos, const char* end)
+  {
+    // `pos` points to the opening quote. Escape sequences are not checked.
+    // If the string is not closed in this line, its end is left for the
+    // parser to diagnose.
+    char head = *pos;
+    pos ++;
+    for(;;) {
+      pos += do_plain_string_length(pos, static_cast<size_t>(end - pos), head);
+      if(pos == end)
+        return nullptr;
+
+      if(*pos == head)
+        return pos + 1;
+
+      if(*pos == '\n')
+        return pos;
+
+      if(end - pos < 2)
+        return nullptr;
+
+      pos += 2;
+    }
+  }
+
+const char*
+do_skip_value_opt(const char* pos, const char* end)
+  {
+    // Locate the end of the value that starts at `pos`, which shall not be a
+    // space. Invalid text is left for the parser to diagnose. If more text is
+    // needed, a null pointer is returned.
+    switch(*pos) {
+      case '\"':
+      case '\'':
+        return do_skip_string_opt(pos, end);
+
+      case '[':
+      case '{': {
+        // Skip nested arrays and objects, as well as strings and comments
+        // within them.
+        size_t depth = 0;
+        while(pos != end)
+          switch(*pos) {
+            case '\"':
+            case '\'':
+              pos = do_skip_string_opt(pos, end);
+              if(!pos)
+                return nullptr;
+              break;
+
+            case '[':
+            case '{':
+              depth ++;
+              pos ++;
+              break;
+
+            case ']':
+            case '}':
+              depth --;
+              pos ++;
+              if(depth == 0)
+                return pos;
+              break;
+
+            case '/':
+              if(end - pos < 2)
+                return nullptr;
+
+              if((pos[1] == '/') || (pos[1] == '*')) {
+                if(!do_skip_spaces_partial(pos, end))
+                  return nullptr;
+                break;
+              }
+              pos ++;
+              break;
+
+            default:
+              pos ++;
+              break;
+          }
+        return nullptr;
+      }
+
+      default: {
+        // Skip a number or a literal.
+        auto sptr = pos;
+        while((pos != end) && (is_cmask(*pos, cmask_namei | cmask_digit)
+                               || ::rocket::is_any_of(*pos, { '+', '-', '.', '`' })))
+          pos ++;
+
+        if(pos == end)
+          return nullptr;
+
+        // Leave a bad character for the parser.
+        return pos + (pos == sptr);
+      }
+    }
+  }
+
+char
+do_stream_peek(JSON_Stream& strm)
+  {
+    // Skip spaces and comments, and return the next character. Null is
+    // returned at the end of input, where the parser will report errors about
+    // incomplete comments.
+    for(;;) {
+      auto pos = strm.begin();
+      bool found = do_skip_spaces_partial(pos, strm.end());
+      strm.consume_to(pos);
+      if(found)
+        return *pos;
+
+      if(!strm.fill())
+        return (strm.begin() == strm.end()) ? '\0' : *(strm.begin());
+    }
+  }
+
+void
+do_stream_prepare(JSON_Stream& strm, JSON_Reader& reader)
+  {
+    // Ensure the window contains a complete value, then validate it.
+    const char* vend;
+    while(!(vend = do_skip_value_opt(strm.begin(), strm.end())))
+      if(!strm.fill()) {
+        vend = strm.end();
+        break;
+      }
+
+    reader.reset(strm.begin(), static_cast<size_t>(vend - strm.begin()), strm.line(), strm.column());
+    do_validate_text(reader);
+  }
+
+Value
+do_stream_parse_value(JSON_Stream& strm, JSON_Reader& reader)
+  {
+    do_stream_prepare(strm, reader);
+    auto value = do_parse_nonrecursive(reader);
+    strm.consume_to(reader.data());
+    return value;
+  }
+
+cow_string
+do_stream_parse_key(JSON_Stream& strm, JSON_Reader& reader)
+  {
+    cow_string key;
+    do_stream_prepare(strm, reader);
+    char c = reader.peek();
+    if((c == '\"') || (c == '\''))
+      do_accept_string(key, reader);
+    else if(is_cmask(c, cmask_namei)) {
+      size_t tlen = do_name_length(reader, 0);
+      key.assign(reader.data(), tlen);
+      reader.consume(tlen);
+    }
+    else
+      throw Compiler_Error(Compiler_Error::M_status(),
+                compiler_status_closing_brace_or_json5_key_expected, reader.tell());
+
+    strm.consume_to(reader.data());
+    if(do_stream_peek(strm) != ':')
+      throw Compiler_Error(Compiler_Error::M_status(),
+                compiler_status_colon_expected, do_stream_tell(strm));
+
+    strm.consume_to(strm.begin() + 1);
+    return key;
+  }
+
+void
+do_stream_invoke(Global_Context& global, const V_function& callback, int64_t index, Value&& value)
+  {
+    // Call the function but discard its return value.
+    Reference self;
+    Reference_Stack stack;
+    stack.push().set_temporary(index);
+    stack.push().set_temporary(::std::move(value));
+    self.set_temporary(nullopt);
+    callback.invoke(self, global, ::std::move(stack));
+  }
+
 }  // namespace
 
 V_string
@@ -701,8 +1733,8 @@ std_json_format(Value value, optV_string indent, optV_boolean json5)
   {
     // No line break is inserted if `indent` is null or empty.
     return (!indent || indent->empty())
-        ? do_format_nonrecursive(value, json5 == true, Indenter_none())
-        : do_format_nonrecursive(value, json5 == true, Indenter_string(*indent));
+        ? do_format_string(value, json5 == true, Indenter_none())
+        : do_format_string(value, json5 == true, Indenter_string(*indent));
   }
 
 V_string
@@ -710,33 +1742,170 @@ std_json_format(Value value, V_integer indent, optV_boolean json5)
   {
     // No line break is inserted if `indent` is non-positive.
     return (indent <= 0)
-        ? do_format_nonrecursive(value, json5 == true, Indenter_none())
-        : do_format_nonrecursive(value, json5 == true, Indenter_spaces(indent));
+        ? do_format_string(value, json5 == true, Indenter_none())
+        : do_format_string(value, json5 == true, Indenter_spaces(indent));
+  }
+
+V_integer
+std_json_format_file(V_string path, Value value, optV_string indent, optV_boolean json5)
+  {
+    // No line break is inserted if `indent` is null or empty.
+    return (!indent || indent->empty())
+        ? do_format_file(path, value, json5 == true, Indenter_none())
+        : do_format_file(path, value, json5 == true, Indenter_string(*indent));
+  }
+
+V_integer
+std_json_format_file(V_string path, Value value, V_integer indent, optV_boolean json5)
+  {
+    // No line break is inserted if `indent` is non-positive.
+    return (indent <= 0)
+        ? do_format_file(path, value, json5 == true, Indenter_none())
+        : do_format_file(path, value, json5 == true, Indenter_spaces(indent));
   }
 
 Value
 std_json_parse(V_string text)
   {
-    // Parse characters from the string.
-    ::rocket::tinybuf_str cbuf;
-    cbuf.set_string(text, tinybuf::open_read);
-    return do_parse(cbuf);
+    return do_parse(text.data(), text.size());
   }
 
 Value
 std_json_parse_file(V_string path)
   {
     // Try opening the file.
-    ::rocket::unique_posix_file fp(::fopen(path.safe_c_str(), "rb"));
-    if(!fp)
+    ::rocket::unique_posix_fd fd(::open(path.safe_c_str(), O_RDONLY));
+    if(!fd)
       ASTERIA_THROW_RUNTIME_ERROR((
           "Could not open file '$1'",
-          "[`fopen()` failed: ${errno:full}]"),
+          "[`open()` failed: ${errno:full}]"),
           path);
 
-    // Parse characters from the file.
-    ::rocket::tinybuf_file cbuf(::std::move(fp));
-    return do_parse(cbuf);
+    // Parse large files in place.
+    Mapped_File mapped(fd);
+    if(mapped)
+      return do_parse(mapped.data(), mapped.size());
+
+    // Read the file in whole, as the parser needs contiguous text. The size
+    // is only a hint, as the file may change.
+    struct ::stat info;
+    V_string text;
+    if((::fstat(fd, &info) == 0) && (info.st_size > 0))
+      text.reserve(static_cast<size_t>(info.st_size) + 1);
+
+    for(;;) {
+      size_t nbatch = text.capacity() - text.size();
+      if(nbatch == 0)
+        nbatch = ::std::max<size_t>(text.size(), 0x10000);
+
+      auto insert_pos = text.insert(text.end(), nbatch, '/');
+      ::ssize_t nread = ::read(fd, &*insert_pos, nbatch);
+      if(nread < 0)
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Error reading file '$1'",
+            "[`read()` failed: ${errno:full}]"),
+            path);
+
+      text.erase(insert_pos + nread, text.end());
+      if(nread == 0)
+        break;
+    }
+    return do_parse(text.data(), text.size());
+  }
+
+V_integer
+std_json_parse_stream(Global_Context& global, V_string path, V_function callback, optV_array keys)
+  {
+    JSON_Stream strm(path);
+    JSON_Reader reader("", 0);
+    int64_t count = 0;
+
+    // Remove the UTF-8 BOM, if any.
+    strm.fill();
+    if((strm.end() - strm.begin() >= 3) && (::std::memcmp(strm.begin(), "\xEF\xBB\xBF", 3) == 0))
+      strm.consume_to(strm.begin() + 3);
+
+    if(!keys) {
+      // The file contains a sequence of values, such as NDJSON. Each value
+      // is a record.
+      for(;;) {
+        do_stream_peek(strm);
+        if(strm.begin() == strm.end())
+          break;
+
+        auto value = do_stream_parse_value(strm, reader);
+        do_stream_invoke(global, callback, count, ::std::move(value));
+        count ++;
+      }
+      return count;
+    }
+
+    // Locate the array whose elements are records, by descending into
+    // objects. Values of other keys are skipped without being parsed.
+    for(const auto& elem : *keys) {
+      if(!elem.is_string())
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Invalid key (value `$1`)"), elem);
+
+      const auto& name = elem.as_string();
+      if(do_stream_peek(strm) != '{')
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Key `$1` not found in JSON file '$2'"), name, path);
+
+      strm.consume_to(strm.begin() + 1);
+      for(;;) {
+        if(do_stream_peek(strm) == '}')
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Key `$1` not found in JSON file '$2'"), name, path);
+
+        if(do_stream_parse_key(strm, reader) == name)
+          break;
+
+        do_stream_peek(strm);
+        do_stream_prepare(strm, reader);
+        strm.consume_to(reader.data() + reader.navail());
+
+        char next = do_stream_peek(strm);
+        if(next != ',') {
+          if(next != '}')
+            throw Compiler_Error(Compiler_Error::M_status(),
+                      compiler_status_closing_brace_or_comma_expected, do_stream_tell(strm));
+
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Key `$1` not found in JSON file '$2'"), name, path);
+        }
+        strm.consume_to(strm.begin() + 1);
+      }
+    }
+
+    if(do_stream_peek(strm) != '[')
+      ASTERIA_THROW_RUNTIME_ERROR((
+          "JSON value is not an array (file '$1')"), path);
+
+    // Parse elements one by one. Text after the array is ignored.
+    strm.consume_to(strm.begin() + 1);
+    if(do_stream_peek(strm) == ']')
+      return count;
+
+    for(;;) {
+      auto value = do_stream_parse_value(strm, reader);
+      do_stream_invoke(global, callback, count, ::std::move(value));
+      count ++;
+
+      char next = do_stream_peek(strm);
+      if(next == ']')
+        break;
+
+      if(next != ',')
+        throw Compiler_Error(Compiler_Error::M_status(),
+                  compiler_status_closing_bracket_or_comma_expected, do_stream_tell(strm));
+
+      // A closing bracket may still follow.
+      strm.consume_to(strm.begin() + 1);
+      if(do_stream_peek(strm) == ']')
+        break;
+    }
+    return count;
   }
 
 void
@@ -769,6 +1938,35 @@ create_bindings_json(V_object& result, API_Version /*version*/)
         reader.throw_no_matching_function_call();
       });
 
+    result.insert_or_assign(sref("format_file"),
+      ASTERIA_BINDING(
+        "std.json.format_file", "path, [value], [indent], [json5]",
+        Argument_Reader&& reader)
+      {
+        V_string path;
+        Value value;
+        optV_string sind;
+        V_integer iind;
+        optV_boolean json5;
+
+        reader.start_overload();
+        reader.required(path);
+        reader.optional(value);
+        reader.save_state(0);
+        reader.optional(sind);
+        reader.optional(json5);
+        if(reader.end_overload())
+          return (Value) std_json_format_file(path, value, sind, json5);
+
+        reader.load_state(0);
+        reader.required(iind);
+        reader.optional(json5);
+        if(reader.end_overload())
+          return (Value) std_json_format_file(path, value, iind, json5);
+
+        reader.throw_no_matching_function_call();
+      });
+
     result.insert_or_assign(sref("parse"),
       ASTERIA_BINDING(
         "std.json.parse", "text",
@@ -798,6 +1996,25 @@ create_bindings_json(V_object& result, API_Version /*version*/)
 
         reader.throw_no_matching_function_call();
       });
+
+    result.insert_or_assign(sref("parse_stream"),
+      ASTERIA_BINDING(
+        "std.json.parse_stream", "path, callback, [keys]",
+        Global_Context& global, Argument_Reader&& reader)
+      {
+        V_string path;
+        V_function callback;
+        optV_array keys;
+
+        reader.start_overload();
+        reader.required(path);
+        reader.required(callback);
+        reader.optional(keys);
+        if(reader.end_overload())
+          return (Value) std_json_parse_stream(global, path, callback, keys);
+
+        reader.throw_no_matching_function_call();
+      });
   }
 
 }  // namespace asteria
@@ -14,6 +14,13 @@ std_json_format(Value value, optV_string indent, optV_boolean json5);
 V_string
 std_json_format(Value value, V_integer indent, optV_boolean json5);
 
+// `std.json.format_file`
+V_integer
+std_json_format_file(V_string path, Value value, optV_string indent, optV_boolean json5);
+
+V_integer
+std_json_format_file(V_string path, Value value, V_integer indent, optV_boolean json5);
+
 // `std.json.parse`
 Value
 std_json_parse(V_string text);
@@ -22,6 +29,10 @@ std_json_parse(V_string text);
 Value
 std_json_parse_file(V_string path);
 
+// `std.json.parse_stream`
+V_integer
+std_json_parse_stream(Global_Context& global, V_string path, V_function callback, optV_array keys);
+
 // Create an object that is to be referenced as `std.json`.
 void
 create_bindings_json(V_object& result, API_Version version);
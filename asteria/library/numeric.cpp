@@ -230,6 +230,553 @@ do_unpack(void bswap(WordT&), const V_string& text)
     return values;
   }
 
+// Bulk kernels
+// Integer arithmetic is checked and reports overflows the way the scalar
+// operators do. Real arithmetic follows IEEE 754, so NaNs and infinities
+// propagate. Reductions of reals always use four interleaved accumulators,
+// whichever instruction set is in use, so results do not depend on the CPU.
+void
+do_promote(cow_vector<double>& reals, const cow_vector<int64_t>& ints)
+  {
+    reals.clear();
+    reals.reserve(ints.size());
+    for(int64_t ival : ints)
+      reals.push_back(static_cast<double>(ival));
+  }
+
+bool
+do_unbox(cow_vector<int64_t>& ints, cow_vector<double>& reals, const V_array& data)
+  {
+    // Collect integers until a real is encountered. If all elements are
+    // integers, `true` is returned. Otherwise, all elements are converted
+    // to reals and `false` is returned.
+    ints.clear();
+    ints.reserve(data.size());
+    size_t k = 0;
+    while(k != data.size()) {
+      const auto& val = data[k];
+      if(!val.is_integer())
+        break;
+
+      ints.push_back(val.as_integer());
+      k ++;
+    }
+
+    if(k == data.size())
+      return true;
+
+    do_promote(reals, ints);
+    reals.reserve(data.size());
+    while(k != data.size()) {
+      const auto& val = data[k];
+      if(!val.is_real())
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Non-numeric value in array (element `$1` at index `$2`)"),
+            val, k);
+
+      reals.push_back(val.as_real());
+      k ++;
+    }
+    return false;
+  }
+
+void
+do_verify_lengths(const V_array& x, const V_array& y)
+  {
+    if(x.size() != y.size())
+      ASTERIA_THROW_RUNTIME_ERROR((
+          "Array length mismatch (`$1` and `$2`)"),
+          x.size(), y.size());
+  }
+
+bool
+do_sum_tail(int64_t& sum, const int64_t (&lanes)[4], const int64_t (&abses)[4],
+            const int64_t* ptr, size_t count) noexcept
+  {
+    // Add up absolute values of lanes and remaining elements. Each of them is
+    // known to be within [0,INT64_MAX], but the total may not be.
+    uint64_t bound = 0;
+    for(int64_t aval : abses)
+      if((bound += static_cast<uint64_t>(aval)) > INT64_MAX)
+        return false;
+
+    for(size_t k = 0;  k != count;  ++k)
+      if((ptr[k] == INT64_MIN)
+         || ((bound += static_cast<uint64_t>(::std::abs(ptr[k]))) > INT64_MAX))
+        return false;
+
+    // No partial sum can overflow now.
+    sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for(size_t k = 0;  k != count;  ++k)
+      sum += ptr[k];
+    return true;
+  }
+
+bool
+do_sum_lanes_sse2(int64_t& sum, const int64_t* ptr, size_t count) noexcept
+  {
+    // Sum elements and their absolute values in lanes. If the sum of absolute
+    // values fits in an integer, no partial sum can overflow, in whichever
+    // order elements are added.
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+    __m128i abs0 = _mm_setzero_si128();
+    __m128i abs1 = _mm_setzero_si128();
+    __m128i ovfl = _mm_setzero_si128();
+    size_t k = 0;
+
+    for(;  count - k >= 4;  k += 4) {
+      __m128i x0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + k));
+      __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr + k + 2));
+      acc0 = _mm_add_epi64(acc0, x0);
+      acc1 = _mm_add_epi64(acc1, x1);
+
+      // SSE2 has no 64-bit arithmetic shift, so copy sign bits from the high
+      // halves. The absolute value of `INT64_MIN` has its sign bit set, as
+      // do sums that have exceeded `INT64_MAX`.
+      __m128i s0 = _mm_shuffle_epi32(_mm_srai_epi32(x0, 31), _MM_SHUFFLE(3, 3, 1, 1));
+      __m128i s1 = _mm_shuffle_epi32(_mm_srai_epi32(x1, 31), _MM_SHUFFLE(3, 3, 1, 1));
+      abs0 = _mm_add_epi64(abs0, _mm_sub_epi64(_mm_xor_si128(x0, s0), s0));
+      abs1 = _mm_add_epi64(abs1, _mm_sub_epi64(_mm_xor_si128(x1, s1), s1));
+      ovfl = _mm_or_si128(ovfl, _mm_or_si128(abs0, abs1));
+    }
+
+    if(_mm_movemask_pd(_mm_castsi128_pd(ovfl)) != 0)
+      return false;
+
+    alignas(16) int64_t lanes[4];
+    alignas(16) int64_t abses[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc0);
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes + 2), acc1);
+    _mm_store_si128(reinterpret_cast<__m128i*>(abses), abs0);
+    _mm_store_si128(reinterpret_cast<__m128i*>(abses + 2), abs1);
+    return do_sum_tail(sum, lanes, abses, ptr + k, count - k);
+  }
+
+ROCKET_TARGET("avx2")
+bool
+do_sum_lanes_avx2(int64_t& sum, const int64_t* ptr, size_t count) noexcept
+  {
+    // Sum elements and their absolute values in lanes. If the sum of absolute
+    // values fits in an integer, no partial sum can overflow, in whichever
+    // order elements are added.
+    __m256i acc = _mm256_setzero_si256();
+    __m256i abs = _mm256_setzero_si256();
+    __m256i ovfl = _mm256_setzero_si256();
+    size_t k = 0;
+
+    for(;  count - k >= 4;  k += 4) {
+      __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + k));
+      acc = _mm256_add_epi64(acc, x);
+
+      // The absolute value of `INT64_MIN` has its sign bit set, as do sums
+      // that have exceeded `INT64_MAX`.
+      __m256i sx = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+      abs = _mm256_add_epi64(abs, _mm256_sub_epi64(_mm256_xor_si256(x, sx), sx));
+      ovfl = _mm256_or_si256(ovfl, abs);
+    }
+
+    if(_mm256_movemask_pd(_mm256_castsi256_pd(ovfl)) != 0)
+      return false;
+
+    alignas(32) int64_t lanes[4];
+    alignas(32) int64_t abses[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(abses), abs);
+    return do_sum_tail(sum, lanes, abses, ptr + k, count - k);
+  }
+
+bool
+do_sum_bounded(int64_t& sum, const int64_t* ptr, size_t count) noexcept
+  {
+    return cpu_has_avx2() ? do_sum_lanes_avx2(sum, ptr, count)
+                          : do_sum_lanes_sse2(sum, ptr, count);
+  }
+
+struct Real_add
+  {
+    static constexpr double identity = 0.0;
+
+    static
+    double
+    scalar(double x, double y) noexcept
+      { return x + y;  }
+
+    static
+    __m128d
+    sse2(__m128d x, __m128d y) noexcept
+      { return _mm_add_pd(x, y);  }
+
+    ROCKET_TARGET("avx2") static
+    __m256d
+    avx2(__m256d x, __m256d y) noexcept
+      { return _mm256_add_pd(x, y);  }
+  };
+
+struct Real_mul
+  {
+    static constexpr double identity = 1.0;
+
+    static
+    double
+    scalar(double x, double y) noexcept
+      { return x * y;  }
+
+    static
+    __m128d
+    sse2(__m128d x, __m128d y) noexcept
+      { return _mm_mul_pd(x, y);  }
+
+    ROCKET_TARGET("avx2") static
+    __m256d
+    avx2(__m256d x, __m256d y) noexcept
+      { return _mm256_mul_pd(x, y);  }
+  };
+
+template<typename OpT>
+double
+do_reduce_sse2(const double* ptr, size_t count) noexcept
+  {
+    // Lanes are `{ 0, 1 }` and `{ 2, 3 }`.
+    __m128d acc0 = _mm_set1_pd(OpT::identity);
+    __m128d acc1 = _mm_set1_pd(OpT::identity);
+    size_t k = 0;
+
+    for(;  count - k >= 4;  k += 4) {
+      acc0 = OpT::sse2(acc0, _mm_loadu_pd(ptr + k));
+      acc1 = OpT::sse2(acc1, _mm_loadu_pd(ptr + k + 2));
+    }
+
+    // Combine lanes as `(0 + 2) + (1 + 3)`.
+    acc0 = OpT::sse2(acc0, acc1);
+    double res = OpT::scalar(_mm_cvtsd_f64(acc0), _mm_cvtsd_f64(_mm_unpackhi_pd(acc0, acc0)));
+    for(;  k != count;  ++k)
+      res = OpT::scalar(res, ptr[k]);
+    return res;
+  }
+
+template<typename OpT>
+ROCKET_TARGET("avx2")
+double
+do_reduce_avx2(const double* ptr, size_t count) noexcept
+  {
+    // Lanes are `{ 0, 1, 2, 3 }`.
+    __m256d acc = _mm256_set1_pd(OpT::identity);
+    size_t k = 0;
+
+    for(;  count - k >= 4;  k += 4)
+      acc = OpT::avx2(acc, _mm256_loadu_pd(ptr + k));
+
+    // Combine lanes as `(0 + 2) + (1 + 3)`.
+    __m128d t = OpT::sse2(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+    double res = OpT::scalar(_mm_cvtsd_f64(t), _mm_cvtsd_f64(_mm_unpackhi_pd(t, t)));
+    for(;  k != count;  ++k)
+      res = OpT::scalar(res, ptr[k]);
+    return res;
+  }
+
+template<typename OpT>
+double
+do_reduce(const double* ptr, size_t count) noexcept
+  {
+    return cpu_has_avx2() ? do_reduce_avx2<OpT>(ptr, count)
+                          : do_reduce_sse2<OpT>(ptr, count);
+  }
+
+double
+do_dot_sse2(const double* xptr, const double* yptr, size_t count) noexcept
+  {
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = _mm_setzero_pd();
+    size_t k = 0;
+
+    for(;  count - k >= 4;  k += 4) {
+      acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(xptr + k), _mm_loadu_pd(yptr + k)));
+      acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(xptr + k + 2), _mm_loadu_pd(yptr + k + 2)));
+    }
+
+    acc0 = _mm_add_pd(acc0, acc1);
+    double res = _mm_cvtsd_f64(acc0) + _mm_cvtsd_f64(_mm_unpackhi_pd(acc0, acc0));
+    for(;  k != count;  ++k)
+      res += xptr[k] * yptr[k];
+    return res;
+  }
+
+ROCKET_TARGET("avx2")
+double
+do_dot_avx2(const double* xptr, const double* yptr, size_t count) noexcept
+  {
+    __m256d acc = _mm256_setzero_pd();
+    size_t k = 0;
+
+    // Don't use FMA, which would round differently.
+    for(;  count - k >= 4;  k += 4)
+      acc = _mm256_add_pd(acc, _mm256_mul_pd(_mm256_loadu_pd(xptr + k), _mm256_loadu_pd(yptr + k)));
+
+    __m128d t = _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+    double res = _mm_cvtsd_f64(t) + _mm_cvtsd_f64(_mm_unpackhi_pd(t, t));
+    for(;  k != count;  ++k)
+      res += xptr[k] * yptr[k];
+    return res;
+  }
+
+template<typename OpT>
+void
+do_map_sse2(double* out, const double* xptr, const double* yptr, size_t count) noexcept
+  {
+    size_t k = 0;
+    for(;  count - k >= 2;  k += 2)
+      _mm_storeu_pd(out + k, OpT::sse2(_mm_loadu_pd(xptr + k), _mm_loadu_pd(yptr + k)));
+
+    for(;  k != count;  ++k)
+      out[k] = OpT::scalar(xptr[k], yptr[k]);
+  }
+
+template<typename OpT>
+ROCKET_TARGET("avx2")
+void
+do_map_avx2(double* out, const double* xptr, const double* yptr, size_t count) noexcept
+  {
+    size_t k = 0;
+    for(;  count - k >= 4;  k += 4)
+      _mm256_storeu_pd(out + k, OpT::avx2(_mm256_loadu_pd(xptr + k), _mm256_loadu_pd(yptr + k)));
+
+    for(;  k != count;  ++k)
+      out[k] = OpT::scalar(xptr[k], yptr[k]);
+  }
+
+template<typename OpT>
+void
+do_map(double* out, const double* xptr, const double* yptr, size_t count) noexcept
+  {
+    return cpu_has_avx2() ? do_map_avx2<OpT>(out, xptr, yptr, count)
+                          : do_map_sse2<OpT>(out, xptr, yptr, count);
+  }
+
+void
+do_axpy_sse2(double* out, double a, const double* xptr, const double* yptr, size_t count) noexcept
+  {
+    __m128d va = _mm_set1_pd(a);
+    size_t k = 0;
+    for(;  count - k >= 2;  k += 2)
+      _mm_storeu_pd(out + k, _mm_add_pd(_mm_mul_pd(va, _mm_loadu_pd(xptr + k)), _mm_loadu_pd(yptr + k)));
+
+    for(;  k != count;  ++k)
+      out[k] = a * xptr[k] + yptr[k];
+  }
+
+ROCKET_TARGET("avx2")
+void
+do_axpy_avx2(double* out, double a, const double* xptr, const double* yptr, size_t count) noexcept
+  {
+    __m256d va = _mm256_set1_pd(a);
+    size_t k = 0;
+    for(;  count - k >= 4;  k += 4)
+      _mm256_storeu_pd(out + k, _mm256_add_pd(_mm256_mul_pd(va, _mm256_loadu_pd(xptr + k)), _mm256_loadu_pd(yptr + k)));
+
+    for(;  k != count;  ++k)
+      out[k] = a * xptr[k] + yptr[k];
+  }
+
+bool
+do_add_integers_sse2(int64_t* out, const int64_t* xptr, const int64_t* yptr, size_t count) noexcept
+  {
+    __m128i ovfl = _mm_setzero_si128();
+    size_t k = 0;
+    for(;  count - k >= 2;  k += 2) {
+      __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(xptr + k));
+      __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(yptr + k));
+      __m128i r = _mm_add_epi64(x, y);
+      ovfl = _mm_or_si128(ovfl, _mm_and_si128(_mm_xor_si128(x, r), _mm_xor_si128(y, r)));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k), r);
+    }
+
+    bool ok = _mm_movemask_pd(_mm_castsi128_pd(ovfl)) == 0;
+    for(;  k != count;  ++k) {
+      // `out` may alias `yptr`, so don't write it directly.
+      int64_t result;
+      ok &= !ROCKET_ADD_OVERFLOW(xptr[k], yptr[k], &result);
+      out[k] = result;
+    }
+    return ok;
+  }
+
+ROCKET_TARGET("avx2")
+bool
+do_add_integers_avx2(int64_t* out, const int64_t* xptr, const int64_t* yptr, size_t count) noexcept
+  {
+    __m256i ovfl = _mm256_setzero_si256();
+    size_t k = 0;
+    for(;  count - k >= 4;  k += 4) {
+      __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(xptr + k));
+      __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(yptr + k));
+      __m256i r = _mm256_add_epi64(x, y);
+      ovfl = _mm256_or_si256(ovfl, _mm256_and_si256(_mm256_xor_si256(x, r), _mm256_xor_si256(y, r)));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), r);
+    }
+
+    bool ok = _mm256_movemask_pd(_mm256_castsi256_pd(ovfl)) == 0;
+    for(;  k != count;  ++k) {
+      // `out` may alias `yptr`, so don't write it directly.
+      int64_t result;
+      ok &= !ROCKET_ADD_OVERFLOW(xptr[k], yptr[k], &result);
+      out[k] = result;
+    }
+    return ok;
+  }
+
+template<bool maxT>
+size_t
+do_find_extremum_sse2(const int64_t* ptr, size_t count) noexcept
+  {
+    // SSE2 has no 64-bit comparison, so this is scalar.
+    size_t r = 0;
+    for(size_t k = 1;  k < count;  ++k)
+      if(maxT ? (ptr[k] > ptr[r]) : (ptr[k] < ptr[r]))
+        r = k;
+    return r;
+  }
+
+template<bool maxT>
+ROCKET_TARGET("avx2")
+size_t
+do_find_extremum_avx2(const int64_t* ptr, size_t count) noexcept
+  {
+    if(count < 8)
+      return do_find_extremum_sse2<maxT>(ptr, count);
+
+    // Find the extreme value, then search for its first occurrence.
+    __m256i acc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    size_t k = 4;
+    for(;  count - k >= 4;  k += 4) {
+      __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr + k));
+      __m256i mask = maxT ? _mm256_cmpgt_epi64(x, acc) : _mm256_cmpgt_epi64(acc, x);
+      acc = _mm256_blendv_epi8(acc, x, mask);
+    }
+
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+
+    int64_t ext = lanes[0];
+    for(size_t i = 1;  i != 4;  ++i)
+      ext = maxT ? ::rocket::max(ext, lanes[i]) : ::rocket::min(ext, lanes[i]);
+    for(;  k != count;  ++k)
+      ext = maxT ? ::rocket::max(ext, ptr[k]) : ::rocket::min(ext, ptr[k]);
+
+    return static_cast<size_t>(::std::find(ptr, ptr + count, ext) - ptr);
+  }
+
+template<bool maxT>
+size_t
+do_find_extremum(const int64_t* ptr, size_t count) noexcept
+  {
+    return cpu_has_avx2() ? do_find_extremum_avx2<maxT>(ptr, count)
+                          : do_find_extremum_sse2<maxT>(ptr, count);
+  }
+
+template<bool maxT>
+size_t
+do_find_extremum_sse2(const double* ptr, size_t count) noexcept
+  {
+    // Find the extreme value, then search for its first occurrence. If a NaN
+    // is encountered, `SIZE_MAX` is returned.
+    __m128d acc = _mm_set1_pd(ptr[0]);
+    __m128d unord = _mm_cmpunord_pd(acc, acc);
+    size_t k = 0;
+    for(;  count - k >= 2;  k += 2) {
+      __m128d x = _mm_loadu_pd(ptr + k);
+      unord = _mm_or_pd(unord, _mm_cmpunord_pd(x, x));
+      acc = maxT ? _mm_max_pd(acc, x) : _mm_min_pd(acc, x);
+    }
+
+    if(_mm_movemask_pd(unord) != 0)
+      return SIZE_MAX;
+
+    double ext = maxT ? ::rocket::max(_mm_cvtsd_f64(acc), _mm_cvtsd_f64(_mm_unpackhi_pd(acc, acc)))
+                      : ::rocket::min(_mm_cvtsd_f64(acc), _mm_cvtsd_f64(_mm_unpackhi_pd(acc, acc)));
+    for(;  k != count;  ++k) {
+      if(::std::isnan(ptr[k]))
+        return SIZE_MAX;
+
+      ext = maxT ? ::rocket::max(ext, ptr[k]) : ::rocket::min(ext, ptr[k]);
+    }
+
+    // Notice that positive and negative zeroes compare equal.
+    return static_cast<size_t>(::std::find(ptr, ptr + count, ext) - ptr);
+  }
+
+template<bool maxT>
+ROCKET_TARGET("avx2")
+size_t
+do_find_extremum_avx2(const double* ptr, size_t count) noexcept
+  {
+    // Find the extreme value, then search for its first occurrence. If a NaN
+    // is encountered, `SIZE_MAX` is returned.
+    __m256d acc = _mm256_set1_pd(ptr[0]);
+    __m256d unord = _mm256_cmp_pd(acc, acc, _CMP_UNORD_Q);
+    size_t k = 0;
+    for(;  count - k >= 4;  k += 4) {
+      __m256d x = _mm256_loadu_pd(ptr + k);
+      unord = _mm256_or_pd(unord, _mm256_cmp_pd(x, x, _CMP_UNORD_Q));
+      acc = maxT ? _mm256_max_pd(acc, x) : _mm256_min_pd(acc, x);
+    }
+
+    if(_mm256_movemask_pd(unord) != 0)
+      return SIZE_MAX;
+
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, acc);
+
+    double ext = lanes[0];
+    for(size_t i = 1;  i != 4;  ++i)
+      ext = maxT ? ::rocket::max(ext, lanes[i]) : ::rocket::min(ext, lanes[i]);
+    for(;  k != count;  ++k) {
+      if(::std::isnan(ptr[k]))
+        return SIZE_MAX;
+
+      ext = maxT ? ::rocket::max(ext, ptr[k]) : ::rocket::min(ext, ptr[k]);
+    }
+
+    // Notice that positive and negative zeroes compare equal.
+    return static_cast<size_t>(::std::find(ptr, ptr + count, ext) - ptr);
+  }
+
+template<bool maxT>
+size_t
+do_find_extremum(const double* ptr, size_t count) noexcept
+  {
+    return cpu_has_avx2() ? do_find_extremum_avx2<maxT>(ptr, count)
+                          : do_find_extremum_sse2<maxT>(ptr, count);
+  }
+
+template<bool maxT>
+optV_integer
+do_extremum_index(const V_array& data)
+  {
+    if(data.empty())
+      return nullopt;
+
+    cow_vector<int64_t> ints;
+    cow_vector<double> reals;
+    if(do_unbox(ints, reals, data))
+      return static_cast<int64_t>(do_find_extremum<maxT>(ints.data(), ints.size()));
+
+    size_t r = do_find_extremum<maxT>(reals.data(), reals.size());
+    if(r != SIZE_MAX)
+      return static_cast<int64_t>(r);
+
+    // A single NaN is returned intact, like `std.numeric.max()`.
+    if(data.size() == 1)
+      return 0;
+
+    r = static_cast<size_t>(::std::find_if(reals.begin(), reals.end(),
+                    [](double x) { return ::std::isnan(x);  }) - reals.begin());
+
+    ASTERIA_THROW_RUNTIME_ERROR((
+        "Values not comparable (operands were `$1` and `$2`)"),
+        data[(r == 0) ? 1 : 0], data[r]);
+  }
+
 }  // namespace
 
 V_integer
@@ -343,6 +890,314 @@ std_numeric_min(cow_vector<Value> values)
     return res;
   }
 
+Value
+std_numeric_sum(V_array data)
+  {
+    cow_vector<int64_t> ints;
+    cow_vector<double> reals;
+    if(!do_unbox(ints, reals, data))
+      return do_reduce<Real_add>(reals.data(), reals.size());
+
+    // If no partial sum can overflow, the result of the SIMD path is exact.
+    // Otherwise, elements are added from left to right, like the operator.
+    int64_t sum;
+    if(do_sum_bounded(sum, ints.data(), ints.size()))
+      return sum;
+
+    sum = 0;
+    for(int64_t ival : ints) {
+      int64_t result;
+      if(ROCKET_ADD_OVERFLOW(sum, ival, &result))
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Integer addition overflow (operands were `$1` and `$2`)"),
+            sum, ival);
+
+      sum = result;
+    }
+    return sum;
+  }
+
+Value
+std_numeric_product(V_array data)
+  {
+    cow_vector<int64_t> ints;
+    cow_vector<double> reals;
+    if(!do_unbox(ints, reals, data))
+      return do_reduce<Real_mul>(reals.data(), reals.size());
+
+    // There is no SIMD instruction for 64-bit multiplication, so this is
+    // scalar. Elements are multiplied from left to right.
+    int64_t prod = 1;
+    for(int64_t ival : ints) {
+      int64_t result;
+      if(ROCKET_MUL_OVERFLOW(prod, ival, &result))
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Integer multiplication overflow (operands were `$1` and `$2`)"),
+            prod, ival);
+
+      prod = result;
+    }
+    return prod;
+  }
+
+optV_real
+std_numeric_mean(V_array data)
+  {
+    if(data.empty())
+      return nullopt;
+
+    cow_vector<int64_t> ints;
+    cow_vector<double> reals;
+    if(!do_unbox(ints, reals, data))
+      return do_reduce<Real_add>(reals.data(), reals.size()) / static_cast<double>(reals.size());
+
+    // The sum of integers is exact and does not overflow.
+    int64_t isum;
+    if(do_sum_bounded(isum, ints.data(), ints.size()))
+      return static_cast<double>(isum) / static_cast<double>(ints.size());
+
+    __int128 sum = 0;
+    for(int64_t ival : ints)
+      sum += ival;
+    return static_cast<double>(sum) / static_cast<double>(ints.size());
+  }
+
+optV_integer
+std_numeric_max_index(V_array data)
+  {
+    return do_extremum_index<true>(data);
+  }
+
+optV_integer
+std_numeric_min_index(V_array data)
+  {
+    return do_extremum_index<false>(data);
+  }
+
+Value
+std_numeric_dot(V_array x, V_array y)
+  {
+    do_verify_lengths(x, y);
+
+    cow_vector<int64_t> xints, yints;
+    cow_vector<double> xreals, yreals;
+    bool xint = do_unbox(xints, xreals, x);
+    bool yint = do_unbox(yints, yreals, y);
+
+    if(xint && yint) {
+      // Elements are accumulated from left to right.
+      int64_t sum = 0;
+      for(size_t k = 0;  k != xints.size();  ++k) {
+        int64_t prod;
+        if(ROCKET_MUL_OVERFLOW(xints[k], yints[k], &prod))
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Integer multiplication overflow (operands were `$1` and `$2`)"),
+              xints[k], yints[k]);
+
+        int64_t result;
+        if(ROCKET_ADD_OVERFLOW(sum, prod, &result))
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Integer addition overflow (operands were `$1` and `$2`)"),
+              sum, prod);
+
+        sum = result;
+      }
+      return sum;
+    }
+
+    if(xint)
+      do_promote(xreals, xints);
+
+    if(yint)
+      do_promote(yreals, yints);
+
+    return cpu_has_avx2() ? do_dot_avx2(xreals.data(), yreals.data(), xreals.size())
+                          : do_dot_sse2(xreals.data(), yreals.data(), xreals.size());
+  }
+
+V_array
+std_numeric_axpy(V_integer a, V_array x, V_array y)
+  {
+    do_verify_lengths(x, y);
+
+    cow_vector<int64_t> xints, yints;
+    cow_vector<double> xreals, yreals;
+    bool xint = do_unbox(xints, xreals, x);
+    bool yint = do_unbox(yints, yreals, y);
+
+    if(!xint || !yint)
+      return std_numeric_axpy(static_cast<V_real>(a), ::std::move(x), ::std::move(y));
+
+    // There is no SIMD instruction for 64-bit multiplication, so this is
+    // scalar.
+    V_array res;
+    res.reserve(xints.size());
+    for(size_t k = 0;  k != xints.size();  ++k) {
+      int64_t prod;
+      if(ROCKET_MUL_OVERFLOW(a, xints[k], &prod))
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Integer multiplication overflow (operands were `$1` and `$2`)"),
+            a, xints[k]);
+
+      int64_t result;
+      if(ROCKET_ADD_OVERFLOW(prod, yints[k], &result))
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Integer addition overflow (operands were `$1` and `$2`)"),
+            prod, yints[k]);
+
+      res.emplace_back(result);
+    }
+    return res;
+  }
+
+V_array
+std_numeric_axpy(V_real a, V_array x, V_array y)
+  {
+    do_verify_lengths(x, y);
+
+    cow_vector<int64_t> xints, yints;
+    cow_vector<double> xreals, yreals;
+    if(do_unbox(xints, xreals, x))
+      do_promote(xreals, xints);
+
+    if(do_unbox(yints, yreals, y))
+      do_promote(yreals, yints);
+
+    // Reuse `yreals` for results. FMA is not used, so results are rounded
+    // exactly like `a * x + y`.
+    double* out = yreals.mut_data();
+    if(cpu_has_avx2())
+      do_axpy_avx2(out, a, xreals.data(), out, yreals.size());
+    else
+      do_axpy_sse2(out, a, xreals.data(), out, yreals.size());
+
+    V_array res;
+    res.append(yreals.begin(), yreals.end());
+    return res;
+  }
+
+V_array
+std_numeric_add_each(V_array x, V_array y)
+  {
+    do_verify_lengths(x, y);
+
+    cow_vector<int64_t> xints, yints;
+    cow_vector<double> xreals, yreals;
+    bool xint = do_unbox(xints, xreals, x);
+    bool yint = do_unbox(yints, yreals, y);
+
+    V_array res;
+    res.reserve(x.size());
+
+    if(xint && yint) {
+      // Reuse `yints` for results.
+      int64_t* out = yints.mut_data();
+      bool ok = cpu_has_avx2() ? do_add_integers_avx2(out, xints.data(), out, yints.size())
+                               : do_add_integers_sse2(out, xints.data(), out, yints.size());
+      if(!ok) {
+        // Find the first element that has overflowed. Its result is known to
+        // have been wrapped, so recover the second operand by subtraction.
+        for(size_t k = 0;  k != xints.size();  ++k) {
+          uint64_t yval = static_cast<uint64_t>(out[k]) - static_cast<uint64_t>(xints[k]);
+          int64_t result;
+          if(ROCKET_ADD_OVERFLOW(xints[k], static_cast<int64_t>(yval), &result))
+            ASTERIA_THROW_RUNTIME_ERROR((
+                "Integer addition overflow (operands were `$1` and `$2`)"),
+                xints[k], static_cast<int64_t>(yval));
+        }
+      }
+
+      res.append(yints.begin(), yints.end());
+      return res;
+    }
+
+    if(xint)
+      do_promote(xreals, xints);
+
+    if(yint)
+      do_promote(yreals, yints);
+
+    double* out = yreals.mut_data();
+    do_map<Real_add>(out, xreals.data(), out, yreals.size());
+    res.append(yreals.begin(), yreals.end());
+    return res;
+  }
+
+V_array
+std_numeric_mul_each(V_array x, V_array y)
+  {
+    do_verify_lengths(x, y);
+
+    cow_vector<int64_t> xints, yints;
+    cow_vector<double> xreals, yreals;
+    bool xint = do_unbox(xints, xreals, x);
+    bool yint = do_unbox(yints, yreals, y);
+
+    V_array res;
+    res.reserve(x.size());
+
+    if(xint && yint) {
+      // There is no SIMD instruction for 64-bit multiplication, so this is
+      // scalar.
+      for(size_t k = 0;  k != xints.size();  ++k) {
+        int64_t result;
+        if(ROCKET_MUL_OVERFLOW(xints[k], yints[k], &result))
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Integer multiplication overflow (operands were `$1` and `$2`)"),
+              xints[k], yints[k]);
+
+        res.emplace_back(result);
+      }
+      return res;
+    }
+
+    if(xint)
+      do_promote(xreals, xints);
+
+    if(yint)
+      do_promote(yreals, yints);
+
+    double* out = yreals.mut_data();
+    do_map<Real_mul>(out, xreals.data(), out, yreals.size());
+    res.append(yreals.begin(), yreals.end());
+    return res;
+  }
+
+V_array
+std_numeric_prefix_sum(V_array data)
+  {
+    cow_vector<int64_t> ints;
+    cow_vector<double> reals;
+    bool all_int = do_unbox(ints, reals, data);
+
+    // Prefix sums are inherently sequential. Elements are accumulated from
+    // left to right, so every result matches that of a script loop.
+    V_array res;
+    res.reserve(data.size());
+
+    if(all_int) {
+      int64_t sum = 0;
+      for(int64_t ival : ints) {
+        int64_t result;
+        if(ROCKET_ADD_OVERFLOW(sum, ival, &result))
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Integer addition overflow (operands were `$1` and `$2`)"),
+              sum, ival);
+
+        sum = result;
+        res.emplace_back(sum);
+      }
+      return res;
+    }
+
+    double sum = 0;
+    for(double fval : reals) {
+      sum += fval;
+      res.emplace_back(sum);
+    }
+    return res;
+  }
+
 V_integer
 std_numeric_clamp(V_integer value, V_integer lower, V_integer upper)
   {
@@ -1086,6 +1941,170 @@ create_bindings_numeric(V_object& result, API_Version /*version*/)
         reader.throw_no_matching_function_call();
       });
 
+    result.insert_or_assign(sref("sum"),
+      ASTERIA_BINDING(
+        "std.numeric.sum", "data",
+        Argument_Reader&& reader)
+      {
+        V_array data;
+
+        reader.start_overload();
+        reader.required(data);
+        if(reader.end_overload())
+          return (Value) std_numeric_sum(data);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("product"),
+      ASTERIA_BINDING(
+        "std.numeric.product", "data",
+        Argument_Reader&& reader)
+      {
+        V_array data;
+
+        reader.start_overload();
+        reader.required(data);
+        if(reader.end_overload())
+          return (Value) std_numeric_product(data);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("mean"),
+      ASTERIA_BINDING(
+        "std.numeric.mean", "data",
+        Argument_Reader&& reader)
+      {
+        V_array data;
+
+        reader.start_overload();
+        reader.required(data);
+        if(reader.end_overload())
+          return (Value) std_numeric_mean(data);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("max_index"),
+      ASTERIA_BINDING(
+        "std.numeric.max_index", "data",
+        Argument_Reader&& reader)
+      {
+        V_array data;
+
+        reader.start_overload();
+        reader.required(data);
+        if(reader.end_overload())
+          return (Value) std_numeric_max_index(data);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("min_index"),
+      ASTERIA_BINDING(
+        "std.numeric.min_index", "data",
+        Argument_Reader&& reader)
+      {
+        V_array data;
+
+        reader.start_overload();
+        reader.required(data);
+        if(reader.end_overload())
+          return (Value) std_numeric_min_index(data);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("dot"),
+      ASTERIA_BINDING(
+        "std.numeric.dot", "x, y",
+        Argument_Reader&& reader)
+      {
+        V_array x, y;
+
+        reader.start_overload();
+        reader.required(x);
+        reader.required(y);
+        if(reader.end_overload())
+          return (Value) std_numeric_dot(x, y);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("axpy"),
+      ASTERIA_BINDING(
+        "std.numeric.axpy", "a, x, y",
+        Argument_Reader&& reader)
+      {
+        V_integer ia;
+        V_real fa;
+        V_array x, y;
+
+        reader.start_overload();
+        reader.required(ia);
+        reader.required(x);
+        reader.required(y);
+        if(reader.end_overload())
+          return (Value) std_numeric_axpy(ia, x, y);
+
+        reader.start_overload();
+        reader.required(fa);
+        reader.required(x);
+        reader.required(y);
+        if(reader.end_overload())
+          return (Value) std_numeric_axpy(fa, x, y);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("add_each"),
+      ASTERIA_BINDING(
+        "std.numeric.add_each", "x, y",
+        Argument_Reader&& reader)
+      {
+        V_array x, y;
+
+        reader.start_overload();
+        reader.required(x);
+        reader.required(y);
+        if(reader.end_overload())
+          return (Value) std_numeric_add_each(x, y);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("mul_each"),
+      ASTERIA_BINDING(
+        "std.numeric.mul_each", "x, y",
+        Argument_Reader&& reader)
+      {
+        V_array x, y;
+
+        reader.start_overload();
+        reader.required(x);
+        reader.required(y);
+        if(reader.end_overload())
+          return (Value) std_numeric_mul_each(x, y);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("prefix_sum"),
+      ASTERIA_BINDING(
+        "std.numeric.prefix_sum", "data",
+        Argument_Reader&& reader)
+      {
+        V_array data;
+
+        reader.start_overload();
+        reader.required(data);
+        if(reader.end_overload())
+          return (Value) std_numeric_prefix_sum(data);
+
+        reader.throw_no_matching_function_call();
+      });
+
     result.insert_or_assign(sref("clamp"),
       ASTERIA_BINDING(
         "std.numeric.clamp", "value, lower, upper",
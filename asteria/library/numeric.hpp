@@ -50,6 +50,49 @@ std_numeric_max(cow_vector<Value> values);
 Value
 std_numeric_min(cow_vector<Value> values);
 
+// `std.numeric.sum`
+Value
+std_numeric_sum(V_array data);
+
+// `std.numeric.product`
+Value
+std_numeric_product(V_array data);
+
+// `std.numeric.mean`
+optV_real
+std_numeric_mean(V_array data);
+
+// `std.numeric.max_index`
+optV_integer
+std_numeric_max_index(V_array data);
+
+// `std.numeric.min_index`
+optV_integer
+std_numeric_min_index(V_array data);
+
+// `std.numeric.dot`
+Value
+std_numeric_dot(V_array x, V_array y);
+
+// `std.numeric.axpy`
+V_array
+std_numeric_axpy(V_integer a, V_array x, V_array y);
+
+V_array
+std_numeric_axpy(V_real a, V_array x, V_array y);
+
+// `std.numeric.add_each`
+V_array
+std_numeric_add_each(V_array x, V_array y);
+
+// `std.numeric.mul_each`
+V_array
+std_numeric_mul_each(V_array x, V_array y);
+
+// `std.numeric.prefix_sum`
+V_array
+std_numeric_prefix_sum(V_array data);
+
 // `std.numeric.clamp`
 V_integer
 std_numeric_clamp(V_integer value, V_integer lower, V_integer upper);
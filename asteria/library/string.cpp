@@ -6,6 +6,8 @@
 #include "../argument_reader.hpp"
 #include "../binding_generator.hpp"
 #include "../runtime/runtime_error.hpp"
+#include "../runtime/global_context.hpp"
+#include "../runtime/regex_cache.hpp"
 #include "../utils.hpp"
 #include <iconv.h>
 #define PCRE2_CODE_UNIT_WIDTH 8
@@ -59,109 +61,215 @@ do_slice(const V_string& text, const V_integer& from, const optV_integer& length
     return do_slice(text, text.begin(), rfrom + *length);
   }
 
+// Substring search
+// These functions search `[tptr,tptr+tlen)` for `[pptr,pptr+plen)`. The
+// caller shall ensure `plen` is non-zero and `tlen` is not less than `plen`.
+// Candidates are located by comparing the first and the last bytes of the
+// pattern, a block at a time, then verified with `memcmp()`.
+const char*
+do_memmem_scalar(const char* tcur, const char* tfinal, const char* pptr, size_t plen) noexcept
+  {
+    while(tcur <= tfinal) {
+      tcur = static_cast<const char*>(::memchr(tcur, pptr[0], static_cast<size_t>(tfinal - tcur) + 1));
+      if(!tcur)
+        return nullptr;
+
+      if(::memcmp(tcur, pptr, plen) == 0)
+        return tcur;
+
+      tcur ++;
+    }
+    return nullptr;
+  }
+
+const char*
+do_memmem_sse2(const char* tptr, size_t tlen, const char* pptr, size_t plen) noexcept
+  {
+    const __m128i first = _mm_set1_epi8(pptr[0]);
+    const __m128i last = _mm_set1_epi8(pptr[plen - 1]);
+    const char* tcur = tptr;
+    const char* tfinal = tptr + (tlen - plen);
+
+    while(tfinal - tcur >= 15) {
+      __m128i tf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tcur));
+      __m128i tl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tcur + plen - 1));
+      uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(
+                         _mm_and_si128(_mm_cmpeq_epi8(tf, first), _mm_cmpeq_epi8(tl, last))));
+
+      while(mask != 0) {
+        uint32_t bit = ROCKET_TZCNT32(mask);
+        if(::memcmp(tcur + bit, pptr, plen) == 0)
+          return tcur + bit;
+
+        mask &= mask - 1;
+      }
+      tcur += 16;
+    }
+    return do_memmem_scalar(tcur, tfinal, pptr, plen);
+  }
+
+ROCKET_TARGET("avx2")
+const char*
+do_memmem_avx2(const char* tptr, size_t tlen, const char* pptr, size_t plen) noexcept
+  {
+    const __m256i first = _mm256_set1_epi8(pptr[0]);
+    const __m256i last = _mm256_set1_epi8(pptr[plen - 1]);
+    const char* tcur = tptr;
+    const char* tfinal = tptr + (tlen - plen);
+
+    while(tfinal - tcur >= 31) {
+      __m256i tf = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tcur));
+      __m256i tl = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tcur + plen - 1));
+      uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+                         _mm256_and_si256(_mm256_cmpeq_epi8(tf, first), _mm256_cmpeq_epi8(tl, last))));
+
+      while(mask != 0) {
+        uint32_t bit = ROCKET_TZCNT32(mask);
+        if(::memcmp(tcur + bit, pptr, plen) == 0)
+          return tcur + bit;
+
+        mask &= mask - 1;
+      }
+      tcur += 32;
+    }
+    return do_memmem_scalar(tcur, tfinal, pptr, plen);
+  }
+
+const char*
+do_memrmem_scalar(const char* tptr, const char* tcur, const char* pptr, size_t plen) noexcept
+  {
+    // `tcur` points past the last candidate.
+    while(tcur != tptr) {
+      tcur --;
+      if((*tcur == pptr[0]) && (::memcmp(tcur, pptr, plen) == 0))
+        return tcur;
+    }
+    return nullptr;
+  }
+
+const char*
+do_memrmem_sse2(const char* tptr, size_t tlen, const char* pptr, size_t plen) noexcept
+  {
+    const __m128i first = _mm_set1_epi8(pptr[0]);
+    const __m128i last = _mm_set1_epi8(pptr[plen - 1]);
+    const char* tcur = tptr + (tlen - plen) + 1;
+
+    while(tcur - tptr >= 16) {
+      const char* tblk = tcur - 16;
+      __m128i tf = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tblk));
+      __m128i tl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(tblk + plen - 1));
+      uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(
+                         _mm_and_si128(_mm_cmpeq_epi8(tf, first), _mm_cmpeq_epi8(tl, last))));
+
+      while(mask != 0) {
+        uint32_t bit = 31U - ROCKET_LZCNT32(mask);
+        if(::memcmp(tblk + bit, pptr, plen) == 0)
+          return tblk + bit;
+
+        mask &= ~(1U << bit);
+      }
+      tcur = tblk;
+    }
+    return do_memrmem_scalar(tptr, tcur, pptr, plen);
+  }
+
+ROCKET_TARGET("avx2")
+const char*
+do_memrmem_avx2(const char* tptr, size_t tlen, const char* pptr, size_t plen) noexcept
+  {
+    const __m256i first = _mm256_set1_epi8(pptr[0]);
+    const __m256i last = _mm256_set1_epi8(pptr[plen - 1]);
+    const char* tcur = tptr + (tlen - plen) + 1;
+
+    while(tcur - tptr >= 32) {
+      const char* tblk = tcur - 32;
+      __m256i tf = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tblk));
+      __m256i tl = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tblk + plen - 1));
+      uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+                         _mm256_and_si256(_mm256_cmpeq_epi8(tf, first), _mm256_cmpeq_epi8(tl, last))));
+
+      while(mask != 0) {
+        uint32_t bit = 31U - ROCKET_LZCNT32(mask);
+        if(::memcmp(tblk + bit, pptr, plen) == 0)
+          return tblk + bit;
+
+        mask &= ~(1U << bit);
+      }
+      tcur = tblk;
+    }
+    return do_memrmem_scalar(tptr, tcur, pptr, plen);
+  }
+
 template<typename IterT>
-class BMH_Searcher
+class Pattern_Searcher
   {
   private:
     IterT m_pbegin, m_pend;
-    ptrdiff_t m_bcr_offsets[0x100];
 
   public:
     inline
-    BMH_Searcher(IterT pbegin, IterT pend)
+    Pattern_Searcher(IterT pbegin, IterT pend)
       :
         m_pbegin(pbegin), m_pend(pend)
       {
-        const ptrdiff_t plen = this->m_pend - this->m_pbegin;
-        if(plen <= 0)
+        if(this->m_pbegin == this->m_pend)
           ASTERIA_THROW_RUNTIME_ERROR(("Empty pattern string not allowed"));
-
-        // Create a table according to the Bad Character Rule.
-        for(ptrdiff_t k = 0;  k != 0x100;  ++k)
-          this->m_bcr_offsets[k] = plen;
-
-        for(ptrdiff_t k = 0;  k != plen - 1;  ++k)
-          this->m_bcr_offsets[uint8_t(this->m_pbegin[k])] = plen - 1 - k;
       }
 
   private:
     static
-    uintptr_t
-    do_xload_word(cow_string::const_iterator tcur) noexcept
+    cow_string::const_iterator
+    do_search_opt(cow_string::const_iterator tbegin, cow_string::const_iterator tend,
+                  cow_string::const_iterator pbegin, cow_string::const_iterator pend) noexcept
       {
-        uintptr_t btext;
-        ::std::memcpy(&btext, &*tcur, sizeof(btext));
-        return btext;
+        auto tptr = &*tbegin;
+        auto tlen = static_cast<size_t>(tend - tbegin);
+        auto pptr = &*pbegin;
+        auto plen = static_cast<size_t>(pend - pbegin);
+
+        auto qfound = cpu_has_avx2() ? do_memmem_avx2(tptr, tlen, pptr, plen)
+                                     : do_memmem_sse2(tptr, tlen, pptr, plen);
+        return qfound ? (tbegin + (qfound - tptr)) : tend;
       }
 
     static
-    uintptr_t
-    do_xload_word(cow_string::const_reverse_iterator tcur) noexcept
+    cow_string::const_reverse_iterator
+    do_search_opt(cow_string::const_reverse_iterator tbegin, cow_string::const_reverse_iterator tend,
+                  cow_string::const_reverse_iterator pbegin, cow_string::const_reverse_iterator pend) noexcept
       {
-        uintptr_t btext;
-        ::std::memcpy(&btext, &*tcur + 1 - sizeof(btext), sizeof(btext));
-        return btext;
+        // Search the forward text for the forward pattern backwards. The
+        // result designates the last byte of the match.
+        auto tptr = &*(tend.base());
+        auto tlen = static_cast<size_t>(tend - tbegin);
+        auto pptr = &*(pend.base());
+        auto plen = static_cast<size_t>(pend - pbegin);
+
+        auto qfound = cpu_has_avx2() ? do_memrmem_avx2(tptr, tlen, pptr, plen)
+                                     : do_memrmem_sse2(tptr, tlen, pptr, plen);
+        return qfound ? (tend - (qfound - tptr) - static_cast<ptrdiff_t>(plen)) : tend;
       }
 
   public:
     opt<IterT>
     search_opt(IterT tbegin, IterT tend) const
       {
-        const ptrdiff_t plen = this->m_pend - this->m_pbegin;
-        ROCKET_ASSERT(plen != 0);
-
         // If no enough bytes are given, there can't be matches.
-        if(tend - tbegin < plen)
+        if(tend - tbegin < this->m_pend - this->m_pbegin)
           return nullopt;
 
-        // Perform a linear search for the first byte.
-        // This has to be fast, but need not be very accurate.
-        constexpr uintptr_t bmask = UINTPTR_MAX / 0xFF;
-        constexpr ptrdiff_t bsize = sizeof(bmask);
-        const uintptr_t bcomp = bmask * (uint8_t) this->m_pbegin[0];
-
-        auto tcur = tbegin;
-        const auto tfinalcand = tend - plen;
-
-        while(tfinalcand - tcur >= bsize) {
-          // Load a word and check whether it contains the first pattern byte.
-          // Endianness does not matter.
-          uintptr_t btext = this->do_xload_word(tcur) ^ bcomp;
-
-          // Now see whether `btext` contains a zero byte. The condition
-          // is that there shall be a byte whose MSB becomes one after the
-          // subtraction below, but was zero before it.
-          if((btext - bmask) & (btext ^ (bmask << 7)) & (bmask << 7))
-            break;
-
-          // Shift the read pointer past this word.
-          tcur += bsize;
-        }
-
-        while(tfinalcand - tcur >= 0) {
-          // Compare candidate intervals from right to left.
-          ptrdiff_t tml = plen - 1;
-          auto tcand = tcur;
-          ptrdiff_t bcr_offset = this->m_bcr_offsets[uint8_t(tcand[tml])];
-
-          while(tcand[tml] == this->m_pbegin[tml])
-            if(--tml < 0)
-              return tcand;  // found
-
-          // Shift the read pointer by the proposed offset.
-          tcur += bcr_offset;
-        }
+        auto qit = this->do_search_opt(tbegin, tend, this->m_pbegin, this->m_pend);
+        if(qit == tend)
+          return nullopt;
 
-        // No matches has been found so far.
-        return nullopt;
+        return qit;
       }
   };
 
 template<typename IterT>
-BMH_Searcher<IterT>
+Pattern_Searcher<IterT>
 do_create_searcher_for_pattern(IterT pbegin, IterT pend)
   {
-    return BMH_Searcher<IterT>(pbegin, pend);
+    return Pattern_Searcher<IterT>(pbegin, pend);
   }
 
 template<typename IterT>
@@ -169,7 +277,7 @@ opt<IterT>
 do_find_opt(IterT tbegin, IterT tend, IterT pbegin, IterT pend)
   {
     // If the pattern is empty, there is a match at the beginning.
-    // Don't pass empty patterns to the BMH searcher.
+    // Don't pass empty patterns to the searcher.
     if(pbegin == pend)
       return tbegin;
 
@@ -177,25 +285,223 @@ do_find_opt(IterT tbegin, IterT tend, IterT pbegin, IterT pend)
     if(tbegin == tend)
       return nullopt;
 
-    // This is the slow path.
     const auto srch = do_create_searcher_for_pattern(pbegin, pend);
     return srch.search_opt(tbegin, tend);
   }
 
-template<typename IterT>
-opt<IterT>
-do_find_of_opt(IterT begin, IterT end, const V_string& set, bool match)
+// Character class scanning
+// A set of bytes is stored as a 256-bit table, in a layout that allows it to
+// be looked up with `pshufb`: The low nibble of a byte selects a row, and the
+// high nibble selects a bit in `m_rows[0]` (for bytes below 0x80) or
+// `m_rows[1]` (for others).
+class Byte_Set
   {
-    bool table[256] = { };
+  private:
+    alignas(16) uint8_t m_rows[2][16];
 
-    for(char c : set)
-      table[(uint8_t)c] = true;
+  public:
+    explicit
+    Byte_Set(const V_string& set) noexcept
+      {
+        ::std::memset(this->m_rows, 0, sizeof(this->m_rows));
+        for(char c : set)
+          this->m_rows[uint8_t(c) >> 7][uint8_t(c) & 15] |= uint8_t(1U << (uint8_t(c) >> 4 & 7));
+      }
 
-    for(auto it = begin;  it != end;  ++it)
-      if(table[(uint8_t)*it] == match)
-        return ::std::move(it);
+    bool
+    test(char c) const noexcept
+      { return this->m_rows[uint8_t(c) >> 7][uint8_t(c) & 15] >> (uint8_t(c) >> 4 & 7) & 1;  }
 
-    return nullopt;
+    const uint8_t*
+    row(size_t k) const noexcept
+      { return this->m_rows[k];  }
+  };
+
+ROCKET_TARGET("ssse3")
+uint32_t
+do_classify_ssse3(__m128i text, __m128i row_lo, __m128i row_hi) noexcept
+  {
+    // `pshufb` yields zero for indices with the MSB set, so for each byte,
+    // exactly one of the row lookups is non-zero.
+    __m128i t = _mm_and_si128(text, _mm_set1_epi8(-0x71));
+    __m128i row = _mm_or_si128(_mm_shuffle_epi8(row_lo, t),
+                               _mm_shuffle_epi8(row_hi, _mm_xor_si128(t, _mm_set1_epi8(-0x80))));
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(text, 4), _mm_set1_epi8(0x0F));
+    __m128i bit = _mm_shuffle_epi8(_mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                                 1, 2, 4, 8, 16, 32, 64, -128), hi);
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(row, bit), bit)));
+  }
+
+ROCKET_TARGET("avx2")
+uint32_t
+do_classify_avx2(__m256i text, __m256i row_lo, __m256i row_hi) noexcept
+  {
+    __m256i t = _mm256_and_si256(text, _mm256_set1_epi8(-0x71));
+    __m256i row = _mm256_or_si256(_mm256_shuffle_epi8(row_lo, t),
+                                  _mm256_shuffle_epi8(row_hi, _mm256_xor_si256(t, _mm256_set1_epi8(-0x80))));
+    __m256i hi = _mm256_and_si256(_mm256_srli_epi16(text, 4), _mm256_set1_epi8(0x0F));
+    __m256i bit = _mm256_shuffle_epi8(_mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                                       1, 2, 4, 8, 16, 32, 64, -128,
+                                                       1, 2, 4, 8, 16, 32, 64, -128,
+                                                       1, 2, 4, 8, 16, 32, 64, -128), hi);
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit)));
+  }
+
+// These functions return a pointer to the first (or last, for `rscan`) byte
+// in `[ptr,ptr+len)` whose membership in `set` equals `match`, or a null
+// pointer if no such byte exists.
+const char*
+do_scan_bytes_scalar(const char* ptr, const char* end, const Byte_Set& set, bool match) noexcept
+  {
+    for(auto cur = ptr;  cur != end;  ++cur)
+      if(set.test(*cur) == match)
+        return cur;
+
+    return nullptr;
+  }
+
+ROCKET_TARGET("ssse3")
+const char*
+do_scan_bytes_ssse3(const char* ptr, size_t len, const Byte_Set& set, bool match) noexcept
+  {
+    const __m128i row_lo = _mm_load_si128(reinterpret_cast<const __m128i*>(set.row(0)));
+    const __m128i row_hi = _mm_load_si128(reinterpret_cast<const __m128i*>(set.row(1)));
+    const uint32_t flip = match ? 0U : 0xFFFFU;
+    const char* cur = ptr;
+    const char* end = ptr + len;
+
+    while(end - cur >= 16) {
+      __m128i text = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cur));
+      uint32_t mask = do_classify_ssse3(text, row_lo, row_hi) ^ flip;
+      if(mask != 0)
+        return cur + ROCKET_TZCNT32(mask);
+
+      cur += 16;
+    }
+    return do_scan_bytes_scalar(cur, end, set, match);
+  }
+
+ROCKET_TARGET("avx2")
+const char*
+do_scan_bytes_avx2(const char* ptr, size_t len, const Byte_Set& set, bool match) noexcept
+  {
+    const __m256i row_lo = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(set.row(0))));
+    const __m256i row_hi = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(set.row(1))));
+    const uint32_t flip = match ? 0U : 0xFFFFFFFFU;
+    const char* cur = ptr;
+    const char* end = ptr + len;
+
+    while(end - cur >= 32) {
+      __m256i text = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(cur));
+      uint32_t mask = do_classify_avx2(text, row_lo, row_hi) ^ flip;
+      if(mask != 0)
+        return cur + ROCKET_TZCNT32(mask);
+
+      cur += 32;
+    }
+    return do_scan_bytes_scalar(cur, end, set, match);
+  }
+
+const char*
+do_scan_bytes(const char* ptr, size_t len, const Byte_Set& set, bool match) noexcept
+  {
+    if(cpu_has_avx2())
+      return do_scan_bytes_avx2(ptr, len, set, match);
+    else if(cpu_has_ssse3())
+      return do_scan_bytes_ssse3(ptr, len, set, match);
+    else
+      return do_scan_bytes_scalar(ptr, ptr + len, set, match);
+  }
+
+const char*
+do_rscan_bytes_scalar(const char* ptr, const char* end, const Byte_Set& set, bool match) noexcept
+  {
+    for(auto cur = end;  cur != ptr;  )
+      if(set.test(*--cur) == match)
+        return cur;
+
+    return nullptr;
+  }
+
+ROCKET_TARGET("ssse3")
+const char*
+do_rscan_bytes_ssse3(const char* ptr, size_t len, const Byte_Set& set, bool match) noexcept
+  {
+    const __m128i row_lo = _mm_load_si128(reinterpret_cast<const __m128i*>(set.row(0)));
+    const __m128i row_hi = _mm_load_si128(reinterpret_cast<const __m128i*>(set.row(1)));
+    const uint32_t flip = match ? 0U : 0xFFFFU;
+    const char* end = ptr + len;
+
+    while(end - ptr >= 16) {
+      __m128i text = _mm_loadu_si128(reinterpret_cast<const __m128i*>(end - 16));
+      uint32_t mask = do_classify_ssse3(text, row_lo, row_hi) ^ flip;
+      if(mask != 0)
+        return end - 16 + (31U - ROCKET_LZCNT32(mask));
+
+      end -= 16;
+    }
+    return do_rscan_bytes_scalar(ptr, end, set, match);
+  }
+
+ROCKET_TARGET("avx2")
+const char*
+do_rscan_bytes_avx2(const char* ptr, size_t len, const Byte_Set& set, bool match) noexcept
+  {
+    const __m256i row_lo = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(set.row(0))));
+    const __m256i row_hi = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(set.row(1))));
+    const uint32_t flip = match ? 0U : 0xFFFFFFFFU;
+    const char* end = ptr + len;
+
+    while(end - ptr >= 32) {
+      __m256i text = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(end - 32));
+      uint32_t mask = do_classify_avx2(text, row_lo, row_hi) ^ flip;
+      if(mask != 0)
+        return end - 32 + (31U - ROCKET_LZCNT32(mask));
+
+      end -= 32;
+    }
+    return do_rscan_bytes_scalar(ptr, end, set, match);
+  }
+
+const char*
+do_rscan_bytes(const char* ptr, size_t len, const Byte_Set& set, bool match) noexcept
+  {
+    if(cpu_has_avx2())
+      return do_rscan_bytes_avx2(ptr, len, set, match);
+    else if(cpu_has_ssse3())
+      return do_rscan_bytes_ssse3(ptr, len, set, match);
+    else
+      return do_rscan_bytes_scalar(ptr, ptr + len, set, match);
+  }
+
+opt<V_string::const_iterator>
+do_find_of_opt(V_string::const_iterator begin, V_string::const_iterator end, const V_string& set,
+               bool match)
+  {
+    if(begin == end)
+      return nullopt;
+
+    auto ptr = &*begin;
+    auto qfound = do_scan_bytes(ptr, static_cast<size_t>(end - begin), Byte_Set(set), match);
+    if(!qfound)
+      return nullopt;
+
+    return begin + (qfound - ptr);
+  }
+
+opt<V_string::const_reverse_iterator>
+do_find_of_opt(V_string::const_reverse_iterator begin, V_string::const_reverse_iterator end,
+               const V_string& set, bool match)
+  {
+    if(begin == end)
+      return nullopt;
+
+    auto ptr = &*(end.base());
+    auto qfound = do_rscan_bytes(ptr, static_cast<size_t>(end - begin), Byte_Set(set), match);
+    if(!qfound)
+      return nullopt;
+
+    return end - (qfound - ptr) - 1;
   }
 
 V_string
@@ -261,6 +567,31 @@ constexpr char s_base32_table[] = "AaBbCcDdEeFfGgHhIiJjKkLlMmNnOoPpQqRrSsTtUuVvW
 constexpr char s_base64_table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/==";
 constexpr char s_spaces[] = " \f\n\r\t\v";
 
+struct Digit_Table
+  {
+    // This maps characters to their values. Invalid ones are mapped to -1.
+    int8_t values[256] = { };
+
+    constexpr
+    Digit_Table(const char* digits, size_t count, uint32_t shift) noexcept
+      {
+        for(size_t k = 0;  k != 256;  ++k)
+          this->values[k] = -1;
+
+        for(size_t k = 0;  k != count;  ++k)
+          this->values[uint8_t(digits[k])] = static_cast<int8_t>(k >> shift);
+      }
+
+    constexpr
+    int
+    operator[](char c) const noexcept
+      { return this->values[uint8_t(c)];  }
+  };
+
+constexpr Digit_Table s_base16_values(s_base16_table, 32, 1);
+constexpr Digit_Table s_base32_values(s_base32_table, 64, 1);
+constexpr Digit_Table s_base64_values(s_base64_table, 64, 0);
+
 const char*
 do_xstrchr(const char* str, char c) noexcept
   {
@@ -272,6 +603,448 @@ do_xstrchr(const char* str, char c) noexcept
     return nullptr;
   }
 
+// Codec kernels
+// These functions process as many complete blocks as possible, and return the
+// number of input bytes that have been consumed. Decoders stop before the first
+// block that contains something other than digits, such as spaces, padding
+// characters or invalid characters, which are left to scalar code.
+ROCKET_TARGET("ssse3")
+size_t
+do_hex_encode_ssse3(char* out, const char* in, size_t len) noexcept
+  {
+    const __m128i digits = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                         '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    size_t k = 0;
+
+    while(len - k >= 16) {
+      __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + k));
+      __m128i hi = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(x, 4), nibble));
+      __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(x, nibble));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k * 2), _mm_unpacklo_epi8(hi, lo));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k * 2 + 16), _mm_unpackhi_epi8(hi, lo));
+      k += 16;
+    }
+    return k;
+  }
+
+ROCKET_TARGET("avx2")
+size_t
+do_hex_encode_avx2(char* out, const char* in, size_t len) noexcept
+  {
+    const __m256i digits = _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7',
+                                            '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+                                            '0', '1', '2', '3', '4', '5', '6', '7',
+                                            '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    size_t k = 0;
+
+    while(len - k >= 32) {
+      __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + k));
+      __m256i hi = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble));
+      __m256i lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(x, nibble));
+
+      // Unpacking works within 128-bit lanes, so fix the order of lanes.
+      __m256i t0 = _mm256_unpacklo_epi8(hi, lo);
+      __m256i t1 = _mm256_unpackhi_epi8(hi, lo);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k * 2), _mm256_permute2x128_si256(t0, t1, 0x20));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k * 2 + 32), _mm256_permute2x128_si256(t0, t1, 0x31));
+      k += 32;
+    }
+    return k;
+  }
+
+size_t
+do_hex_encode_bulk(char* out, const char* in, size_t len) noexcept
+  {
+    if(cpu_has_avx2())
+      return do_hex_encode_avx2(out, in, len);
+    else if(cpu_has_ssse3())
+      return do_hex_encode_ssse3(out, in, len);
+    else
+      return 0;
+  }
+
+ROCKET_TARGET("ssse3")
+__m128i
+do_hex_values_ssse3(__m128i x, uint32_t& valid) noexcept
+  {
+    __m128i d = _mm_sub_epi8(x, _mm_set1_epi8('0'));
+    __m128i is_d = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+    __m128i l = _mm_sub_epi8(_mm_or_si128(x, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i is_l = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+    valid = static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(is_d, is_l)));
+    return _mm_or_si128(_mm_and_si128(is_d, d),
+                        _mm_andnot_si128(is_d, _mm_add_epi8(l, _mm_set1_epi8(10))));
+  }
+
+ROCKET_TARGET("ssse3")
+size_t
+do_hex_decode_ssse3(char* out, const char* in, size_t len) noexcept
+  {
+    const __m128i weights = _mm_set1_epi16(0x0110);
+    size_t k = 0;
+
+    while(len - k >= 32) {
+      uint32_t valid0, valid1;
+      __m128i v0 = do_hex_values_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + k)), valid0);
+      __m128i v1 = do_hex_values_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + k + 16)), valid1);
+      if((valid0 & valid1) != 0xFFFFU)
+        break;
+
+      // Combine each pair of digits as `hi * 16 + lo`.
+      __m128i r = _mm_packus_epi16(_mm_maddubs_epi16(v0, weights), _mm_maddubs_epi16(v1, weights));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k / 2), r);
+      k += 32;
+    }
+    return k;
+  }
+
+ROCKET_TARGET("avx2")
+__m256i
+do_hex_values_avx2(__m256i x, uint32_t& valid) noexcept
+  {
+    __m256i d = _mm256_sub_epi8(x, _mm256_set1_epi8('0'));
+    __m256i is_d = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+    __m256i l = _mm256_sub_epi8(_mm256_or_si256(x, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    __m256i is_l = _mm256_cmpeq_epi8(_mm256_min_epu8(l, _mm256_set1_epi8(5)), l);
+    valid = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(is_d, is_l)));
+    return _mm256_or_si256(_mm256_and_si256(is_d, d),
+                           _mm256_andnot_si256(is_d, _mm256_add_epi8(l, _mm256_set1_epi8(10))));
+  }
+
+ROCKET_TARGET("avx2")
+size_t
+do_hex_decode_avx2(char* out, const char* in, size_t len) noexcept
+  {
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+    size_t k = 0;
+
+    while(len - k >= 64) {
+      uint32_t valid0, valid1;
+      __m256i v0 = do_hex_values_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + k)), valid0);
+      __m256i v1 = do_hex_values_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + k + 32)), valid1);
+      if((valid0 & valid1) != 0xFFFFFFFFU)
+        break;
+
+      // Packing works within 128-bit lanes, so fix the order of quadwords.
+      __m256i r = _mm256_packus_epi16(_mm256_maddubs_epi16(v0, weights), _mm256_maddubs_epi16(v1, weights));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k / 2), _mm256_permute4x64_epi64(r, 0xD8));
+      k += 64;
+    }
+    return k;
+  }
+
+size_t
+do_hex_decode_bulk(char* out, const char* in, size_t len) noexcept
+  {
+    if(cpu_has_avx2())
+      return do_hex_decode_avx2(out, in, len);
+    else if(cpu_has_ssse3())
+      return do_hex_decode_ssse3(out, in, len);
+    else
+      return 0;
+  }
+
+ROCKET_TARGET("ssse3")
+__m128i
+do_base64_digits_ssse3(__m128i x) noexcept
+  {
+    // Split three bytes into four groups of 6 bits. This is described in
+    // 'Base64 encoding with SIMD instructions' by Wojciech Muła.
+    x = _mm_shuffle_epi8(x, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(x, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+    __m128i t1 = _mm_mullo_epi16(_mm_and_si128(x, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+    __m128i v = _mm_or_si128(t0, t1);
+
+    // Map values to characters: 0-25 to `A-Z`, 26-51 to `a-z`, 52-61 to
+    // `0-9`, 62 to `+` and 63 to `/`.
+    __m128i r = _mm_subs_epu8(v, _mm_set1_epi8(51));
+    r = _mm_or_si128(r, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), v), _mm_set1_epi8(13)));
+    r = _mm_shuffle_epi8(_mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                       '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                       '/' - 63, 'A', 0, 0), r);
+    return _mm_add_epi8(r, v);
+  }
+
+ROCKET_TARGET("ssse3")
+size_t
+do_base64_encode_ssse3(char* out, const char* in, size_t len) noexcept
+  {
+    size_t k = 0;
+
+    // Each iteration reads 16 bytes but consumes only 12.
+    while(len - k >= 16) {
+      __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + k));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k / 3 * 4), do_base64_digits_ssse3(x));
+      k += 12;
+    }
+    return k;
+  }
+
+ROCKET_TARGET("avx2")
+__m256i
+do_base64_digits_avx2(__m256i x) noexcept
+  {
+    x = _mm256_shuffle_epi8(x, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                                               10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(x, _mm256_set1_epi32(0x0FC0FC00)),
+                                    _mm256_set1_epi32(0x04000040));
+    __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(x, _mm256_set1_epi32(0x003F03F0)),
+                                    _mm256_set1_epi32(0x01000010));
+    __m256i v = _mm256_or_si256(t0, t1);
+
+    __m256i r = _mm256_subs_epu8(v, _mm256_set1_epi8(51));
+    r = _mm256_or_si256(r, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), v), _mm256_set1_epi8(13)));
+    r = _mm256_shuffle_epi8(_mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                             '/' - 63, 'A', 0, 0,
+                                             'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                             '/' - 63, 'A', 0, 0), r);
+    return _mm256_add_epi8(r, v);
+  }
+
+ROCKET_TARGET("avx2")
+size_t
+do_base64_encode_avx2(char* out, const char* in, size_t len) noexcept
+  {
+    size_t k = 0;
+
+    // Each iteration reads 28 bytes but consumes only 24.
+    while(len - k >= 28) {
+      __m256i x = _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + k)));
+      x = _mm256_inserti128_si256(x, _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + k + 12)), 1);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k / 3 * 4), do_base64_digits_avx2(x));
+      k += 24;
+    }
+    return k;
+  }
+
+size_t
+do_base64_encode_bulk(char* out, const char* in, size_t len) noexcept
+  {
+    if(cpu_has_avx2())
+      return do_base64_encode_avx2(out, in, len);
+    else if(cpu_has_ssse3())
+      return do_base64_encode_ssse3(out, in, len);
+    else
+      return 0;
+  }
+
+const Byte_Set&
+do_base64_digit_set() noexcept
+  {
+    static const Byte_Set s_set(sref("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"));
+    return s_set;
+  }
+
+ROCKET_TARGET("ssse3")
+size_t
+do_base64_decode_ssse3(char* out, const char* in, size_t len) noexcept
+  {
+    const Byte_Set& set = do_base64_digit_set();
+    const __m128i row_lo = _mm_load_si128(reinterpret_cast<const __m128i*>(set.row(0)));
+    const __m128i row_hi = _mm_load_si128(reinterpret_cast<const __m128i*>(set.row(1)));
+    size_t k = 0;
+
+    while(len - k >= 16) {
+      __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + k));
+      if(do_classify_ssse3(x, row_lo, row_hi) != 0xFFFFU)
+        break;
+
+      // Map characters to values, according to their high nibbles.
+      __m128i shift = _mm_shuffle_epi8(_mm_setr_epi8(0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0),
+                                       _mm_and_si128(_mm_srli_epi16(x, 4), _mm_set1_epi8(0x0F)));
+      shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8('/')), _mm_set1_epi8(-3)));
+      __m128i v = _mm_add_epi8(x, shift);
+
+      // Merge four groups of 6 bits into three bytes, in big-endian order.
+      // N.B. This writes 4 bytes past the end of output.
+      v = _mm_madd_epi16(_mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+      v = _mm_shuffle_epi8(v, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k / 4 * 3), v);
+      k += 16;
+    }
+    return k;
+  }
+
+ROCKET_TARGET("avx2")
+size_t
+do_base64_decode_avx2(char* out, const char* in, size_t len) noexcept
+  {
+    const Byte_Set& set = do_base64_digit_set();
+    const __m256i row_lo = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(set.row(0))));
+    const __m256i row_hi = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(set.row(1))));
+    size_t k = 0;
+
+    while(len - k >= 32) {
+      __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + k));
+      if(do_classify_avx2(x, row_lo, row_hi) != 0xFFFFFFFFU)
+        break;
+
+      __m256i shift = _mm256_shuffle_epi8(_mm256_setr_epi8(0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                           0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0),
+                                          _mm256_and_si256(_mm256_srli_epi16(x, 4), _mm256_set1_epi8(0x0F)));
+      shift = _mm256_add_epi8(shift, _mm256_and_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8('/')),
+                                                      _mm256_set1_epi8(-3)));
+      __m256i v = _mm256_add_epi8(x, shift);
+
+      // Each 128-bit lane yields 12 bytes, which are then made contiguous.
+      // N.B. This writes 8 bytes past the end of output.
+      v = _mm256_madd_epi16(_mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+      v = _mm256_shuffle_epi8(v, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                  2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+      v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k / 4 * 3), v);
+      k += 32;
+    }
+    return k;
+  }
+
+size_t
+do_base64_decode_bulk(char* out, const char* in, size_t len) noexcept
+  {
+    if(cpu_has_avx2())
+      return do_base64_decode_avx2(out, in, len);
+    else if(cpu_has_ssse3())
+      return do_base64_decode_ssse3(out, in, len);
+    else
+      return 0;
+  }
+
+const Byte_Set&
+do_url_unreserved_set() noexcept
+  {
+    static const Byte_Set s_set(sref("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_~."));
+    return s_set;
+  }
+
+const Byte_Set&
+do_url_query_unreserved_set() noexcept
+  {
+    static const Byte_Set s_set(sref("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_."));
+    return s_set;
+  }
+
+// These are characters that require attention when decoding a URL: control
+// characters, spaces, percent signs and (for queries only) plus signs.
+constexpr char s_url_specials[] =
+  "\x00\x01\x02\x03\x04\x05\x06\x07\x08\x09\x0A\x0B\x0C\x0D\x0E\x0F"
+  "\x10\x11\x12\x13\x14\x15\x16\x17\x18\x19\x1A\x1B\x1C\x1D\x1E\x1F"
+  " %\x7F\xFF+";
+
+const Byte_Set&
+do_url_special_set(bool query) noexcept
+  {
+    static const Byte_Set s_sets[2] =
+      {
+        Byte_Set(V_string(s_url_specials, sizeof(s_url_specials) - 2)),
+        Byte_Set(V_string(s_url_specials, sizeof(s_url_specials) - 1)),
+      };
+    return s_sets[query];
+  }
+
+V_string
+do_url_encode(const V_string& data, bool query)
+  {
+    const Byte_Set& set = query ? do_url_query_unreserved_set() : do_url_unreserved_set();
+    const char* rptr = data.data();
+    const char* eptr = rptr + data.size();
+
+    // Find the first byte to escape. If there is none, make use of reference
+    // counting.
+    const char* qesc = do_scan_bytes(rptr, data.size(), set, false);
+    if(!qesc)
+      return data;
+
+    // Calculate the length of the result, so it can be allocated at once.
+    size_t nextra = 0;
+    for(auto q = qesc;  q;  q = do_scan_bytes(q + 1, static_cast<size_t>(eptr - q - 1), set, false))
+      nextra += (query && (*q == ' ')) ? 0 : 2;
+
+    V_string text;
+    text.append(data.size() + nextra, '*');
+    char* wptr = text.mut_data();
+
+    while(qesc) {
+      // Copy bytes that don't need escaping verbatim.
+      ::memcpy(wptr, rptr, static_cast<size_t>(qesc - rptr));
+      wptr += qesc - rptr;
+
+      // Escape this byte. Spaces in queries are encoded specially.
+      char c = *qesc;
+      if(query && (c == ' '))
+        *(wptr++) = '+';
+      else {
+        *(wptr++) = '%';
+        *(wptr++) = s_base16_table[(c >> 3) & 0x1E];
+        *(wptr++) = s_base16_table[(c << 1) & 0x1E];
+      }
+
+      rptr = qesc + 1;
+      qesc = do_scan_bytes(rptr, static_cast<size_t>(eptr - rptr), set, false);
+    }
+    ::memcpy(wptr, rptr, static_cast<size_t>(eptr - rptr));
+    return text;
+  }
+
+V_string
+do_url_decode(const V_string& text, bool query)
+  {
+    const Byte_Set& set = do_url_special_set(query);
+    const char* rptr = text.data();
+    const char* eptr = rptr + text.size();
+
+    // Find the first special character. If there is none, make use of
+    // reference counting.
+    const char* qsp = do_scan_bytes(rptr, text.size(), set, true);
+    if(!qsp)
+      return text;
+
+    // Decoding never makes a string longer. The result will be truncated.
+    V_string data;
+    data.append(text.size(), '*');
+    char* wptr = data.mut_data();
+
+    while(qsp) {
+      // Copy bytes that are not special verbatim.
+      ::memcpy(wptr, rptr, static_cast<size_t>(qsp - rptr));
+      wptr += qsp - rptr;
+      rptr = qsp + 1;
+
+      char c = *qsp;
+      if(query && (c == '+')) {
+        // Decode spaces specially.
+        *(wptr++) = ' ';
+      }
+      else if(c == '%') {
+        // Two hexadecimal characters shall follow.
+        if(eptr - rptr < 2)
+          ASTERIA_THROW_RUNTIME_ERROR(("No enough hexadecimal digits after `%`"));
+
+        int hi = s_base16_values[rptr[0]];
+        if(hi < 0)
+          ASTERIA_THROW_RUNTIME_ERROR(("Invalid hexadecimal digit (character `$1`)"), rptr[0]);
+
+        int lo = s_base16_values[rptr[1]];
+        if(lo < 0)
+          ASTERIA_THROW_RUNTIME_ERROR(("Invalid hexadecimal digit (character `$1`)"), rptr[1]);
+
+        *(wptr++) = static_cast<char>(hi << 4 | lo);
+        rptr += 2;
+      }
+      else
+        ASTERIA_THROW_RUNTIME_ERROR(("Invalid character in URL (character `$1`)"), (int) c);
+
+      qsp = do_scan_bytes(rptr, static_cast<size_t>(eptr - rptr), set, true);
+    }
+    ::memcpy(wptr, rptr, static_cast<size_t>(eptr - rptr));
+    wptr += eptr - rptr;
+    data.erase(static_cast<size_t>(wptr - data.data()));
+    return data;
+  }
+
 bool
 do_streq_ci(const V_string& str, V_string::shallow_type cmp) noexcept
   {
@@ -310,6 +1083,30 @@ operator<<(tinyfmt& fmt, const PCRE2_Error& err)
     return fmt << err.c_str();
   }
 
+uint32_t
+do_parse_pcre2_options(bool& jit, const optV_array& opts)
+  {
+    uint32_t bits = PCRE2_NEVER_UTF | PCRE2_NEVER_UCP;
+    if(opts) {
+      for(const auto& opt : *opts)
+        if(do_streq_ci(opt.as_string(), sref("caseless")))
+          bits |= PCRE2_CASELESS;
+        else if(do_streq_ci(opt.as_string(), sref("dotall")))
+          bits |= PCRE2_DOTALL;
+        else if(do_streq_ci(opt.as_string(), sref("extended")))
+          bits |= PCRE2_EXTENDED;
+        else if(do_streq_ci(opt.as_string(), sref("multiline")))
+          bits |= PCRE2_MULTILINE;
+        else if(do_streq_ci(opt.as_string(), sref("jit")))
+          jit = true;
+        else if(!opt.as_string().empty())
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Invalid option for regular expression: $1"),
+              opt);
+    }
+    return bits;
+  }
+
 class PCRE2_Matcher final
   :
     public Abstract_Opaque
@@ -317,6 +1114,7 @@ class PCRE2_Matcher final
   private:
     cow_string m_patt;
     uint32_t m_opts;
+    bool m_jit;
     unique_ptr<::pcre2_code, void (::pcre2_code*)> m_code;
     unique_ptr<::pcre2_match_data, void (::pcre2_match_data*)> m_match;
 
@@ -326,28 +1124,11 @@ class PCRE2_Matcher final
 
   public:
     explicit
-    PCRE2_Matcher(const V_string& patt, const optV_array& opts)
+    PCRE2_Matcher(const V_string& patt, uint32_t opts, bool jit)
       :
-        m_patt(patt), m_opts(PCRE2_NEVER_UTF | PCRE2_NEVER_UCP),
+        m_patt(patt), m_opts(opts), m_jit(jit),
         m_code(::pcre2_code_free), m_match(::pcre2_match_data_free)
       {
-        // Check options.
-        if(opts) {
-          for(const auto& opt : *opts)
-            if(do_streq_ci(opt.as_string(), sref("caseless")))
-              this->m_opts |= PCRE2_CASELESS;
-            else if(do_streq_ci(opt.as_string(), sref("dotall")))
-              this->m_opts |= PCRE2_DOTALL;
-            else if(do_streq_ci(opt.as_string(), sref("extended")))
-              this->m_opts |= PCRE2_EXTENDED;
-            else if(do_streq_ci(opt.as_string(), sref("multiline")))
-              this->m_opts |= PCRE2_MULTILINE;
-            else if(!opt.as_string().empty())
-              ASTERIA_THROW_RUNTIME_ERROR((
-                  "Invalid option for regular expression: $1"),
-                  opt);
-        }
-
         // Compile the regular expression.
         int err;
         size_t off;
@@ -358,12 +1139,14 @@ class PCRE2_Matcher final
               "Invalid regular expression: $1",
               "[`pcre2_compile()` failed at offset `$2`: $3]"),
               this->m_patt, off, PCRE2_Error(err));
+
+        this->do_jit_compile();
       }
 
     explicit
     PCRE2_Matcher(const PCRE2_Matcher& other, int)
       :
-        m_patt(other.m_patt), m_opts(other.m_opts),
+        m_patt(other.m_patt), m_opts(other.m_opts), m_jit(other.m_jit),
         m_code(::pcre2_code_free), m_match(::pcre2_match_data_free)
       {
         // Copy the regular expression.
@@ -371,6 +1154,19 @@ class PCRE2_Matcher final
           ASTERIA_THROW_RUNTIME_ERROR((
               "Could not copy regular expression",
               "[`pcre2_code_copy()` failed]"));
+
+        // JIT code is not copied by `pcre2_code_copy()`.
+        this->do_jit_compile();
+      }
+
+  private:
+    void
+    do_jit_compile() noexcept
+      {
+        // If JIT compilation is unavailable or fails, `pcre2_match()` will
+        // silently fall back to the interpreter, so errors are ignored.
+        if(this->m_jit)
+          ::pcre2_jit_compile(this->m_code, PCRE2_JIT_COMPLETE);
       }
 
   private:
@@ -717,6 +1513,29 @@ struct iconv_closer
       { return ::iconv_close(cd);  }
   };
 
+refcnt_ptr<Abstract_Opaque>
+do_get_cached_PCRE(Global_Context& global, const V_string& pattern, const optV_array& options)
+  {
+    // Patterns that are used by `pcre_*` functions are always JIT-compiled,
+    // as they are cached and will probably be reused.
+    bool jit = true;
+    uint32_t opts = do_parse_pcre2_options(jit, options);
+
+    // The key is the compilation options followed by the pattern.
+    cow_string key;
+    key.reserve(sizeof(opts) + pattern.size());
+    key.append(reinterpret_cast<const char*>(&opts), sizeof(opts));
+    key.append(pattern);
+
+    const auto cache = global.regex_cache();
+    auto ptr = cache->find_opt(key);
+    if(!ptr) {
+      ptr = ::rocket::make_refcnt<PCRE2_Matcher>(pattern, opts, jit);
+      cache->insert(key, ptr);
+    }
+    return ptr;
+  }
+
 }  // namespace
 
 V_string
@@ -872,13 +1691,15 @@ std_string_trim(V_string text, optV_string reject)
       return text;
 
     // Get the index of the first byte to keep.
-    size_t bpos = text.find_not_of(rchars);
-    if(bpos == V_string::npos)
+    const Byte_Set rset(rchars);
+    auto bptr = do_scan_bytes(text.data(), text.size(), rset, false);
+    if(!bptr)
       // There is no byte to keep. Return an empty string.
       return { };
 
     // Get the index of the last byte to keep.
-    size_t epos = text.rfind_not_of(rchars) + 1;
+    size_t bpos = static_cast<size_t>(bptr - text.data());
+    size_t epos = static_cast<size_t>(do_rscan_bytes(bptr, text.size() - bpos, rset, false) + 1 - text.data());
     if((bpos == 0) && (epos == text.size()))
       // There is no byte to strip. Make use of reference counting.
       return text;
@@ -896,11 +1717,12 @@ std_string_triml(V_string text, optV_string reject)
       return text;
 
     // Get the index of the first byte to keep.
-    size_t bpos = text.find_not_of(rchars);
-    if(bpos == V_string::npos)
+    auto bptr = do_scan_bytes(text.data(), text.size(), Byte_Set(rchars), false);
+    if(!bptr)
       // There is no byte to keep. Return an empty string.
       return { };
 
+    size_t bpos = static_cast<size_t>(bptr - text.data());
     if(bpos == 0)
       // There is no byte to strip. Make use of reference counting.
       return text;
@@ -918,11 +1740,12 @@ std_string_trimr(V_string text, optV_string reject)
       return text;
 
     // Get the index of the last byte to keep.
-    size_t epos = text.rfind_not_of(rchars) + 1;
-    if(epos == 0)
+    auto eptr = do_rscan_bytes(text.data(), text.size(), Byte_Set(rchars), false);
+    if(!eptr)
       // There is no byte to keep. Return an empty string.
       return { };
 
+    size_t epos = static_cast<size_t>(eptr + 1 - text.data());
     if(epos == text.size())
       // There is no byte to strip. Make use of reference counting.
       return text;
@@ -1007,28 +1830,37 @@ std_string_to_lower(V_string text)
 V_string
 std_string_translate(V_string text, V_string inputs, optV_string outputs)
   {
-    // Use reference counting as our advantage.
-    V_string res = text;
-    char* wptr = nullptr;
-
-    // Translate each character.
-    for(size_t i = 0;  i < res.size();  ++i) {
-      char c = res[i];
-      auto ipos = inputs.find(c);
-      if(ipos == V_string::npos)
-        continue;
+    // Find the first byte to translate. If there is none, make use of
+    // reference counting.
+    const Byte_Set iset(inputs);
+    const char* tptr = text.data();
+    const char* tend = tptr + text.size();
+    const char* tcur = do_scan_bytes(tptr, text.size(), iset, true);
+    if(!tcur)
+      return text;
 
-      // Fork the string as needed.
-      if(ROCKET_UNEXPECT(!wptr))
-        wptr = res.mut_data();
+    // Build the translation table. Only the first occurrence of a byte in
+    // `inputs` counts. A negative value indicates that the byte is erased.
+    int table[256];
+    for(size_t k = inputs.size() - 1;  k != SIZE_MAX;  --k)
+      table[uint8_t(inputs[k])] = (outputs && (k < outputs->size())) ? uint8_t(outputs->data()[k]) : -1;
 
-      if(!outputs || (ipos >= outputs->size()))
-        // Erase the byte if there is no replacement.
-        // N.B. This must cause no reallocation.
-        res.erase(i--, 1);
-      else
-        // Replace the character.
-        wptr[i] = outputs->data()[ipos];
+    V_string res;
+    res.reserve(text.size());
+    res.append(tptr, tcur);
+    while(tcur != tend) {
+      // Translate this byte.
+      int rc = table[uint8_t(*tcur)];
+      if(rc >= 0)
+        res.push_back(static_cast<char>(rc));
+
+      // Copy bytes that are not translated verbatim.
+      tptr = tcur + 1;
+      tcur = do_scan_bytes(tptr, static_cast<size_t>(tend - tptr), iset, true);
+      if(!tcur)
+        tcur = tend;
+
+      res.append(tptr, tcur);
     }
     return res;
   }
@@ -1106,36 +1938,44 @@ std_string_hex_encode(V_string data, optV_string delim)
     size_t ndelim = delim ? delim->size() : 0;
 
     V_string text;
-    text.reserve(data.size() * (2 + ndelim));
+    if(data.empty())
+      return text;
 
-    // These shall be operated in big-endian order.
-    uint32_t reg = 0;
+    // Allocate the result, which will be filled in place.
+    text.append(data.size() * (2 + ndelim) - ndelim, '*');
+    char* wptr = text.mut_data();
 
     // Encode source data.
     size_t nread = 0;
+    if(ndelim == 0) {
+      nread = do_hex_encode_bulk(wptr, data.data(), data.size());
+      wptr += nread * 2;
+    }
+
     while(nread != data.size()) {
       // Insert a delimiter before every byte other than the first one.
-      if(!text.empty())
-        text.append(pdelim, ndelim);
-
-      // Read a byte.
-      reg = data[nread++] & 0xFF;
-      reg <<= 24;
-
-      // Encode it.
-      for(size_t i = 0;  i < 2;  ++i) {
-        uint32_t b = (reg >> 27) & 0xFE;
-        reg <<= 4;
-        text += s_base16_table[b];
+      if(nread != 0) {
+        ::memcpy(wptr, pdelim, ndelim);
+        wptr += ndelim;
       }
+
+      // Encode a byte.
+      uint32_t b = data[nread++] & 0xFF;
+      *(wptr++) = s_base16_table[(b >> 3) & 0x1E];
+      *(wptr++) = s_base16_table[(b << 1) & 0x1E];
     }
+    ROCKET_ASSERT(wptr == text.data() + text.size());
     return text;
   }
 
 V_string
 std_string_hex_decode(V_string text)
   {
+    // Allocate an upper bound of the result, which will be truncated in the
+    // end. Spaces don't produce data.
     V_string data;
+    data.append(text.size() / 2, '*');
+    char* wptr = data.mut_data();
 
     // These shall be operated in big-endian order.
     uint32_t reg = 1;
@@ -1143,43 +1983,54 @@ std_string_hex_decode(V_string text)
     // Decode source data.
     size_t nread = 0;
     while(nread != text.size()) {
+      // Decode digits in bulk, if this is the beginning of a group.
+      if(reg == 1) {
+        size_t n = do_hex_decode_bulk(wptr, text.data() + nread, text.size() - nread);
+        nread += n;
+        wptr += n / 2;
+        if(nread == text.size())
+          break;
+      }
+
       // Read and identify a character.
       char c = text[nread++];
-      const char* pos = do_xstrchr(s_spaces, c);
-      if(pos) {
+      int v = s_base16_values[c];
+      if(v < 0) {
+        if(!do_xstrchr(s_spaces, c))
+          ASTERIA_THROW_RUNTIME_ERROR(("Invalid hexadecimal digit (character `$1`)"), c);
+
         // The character is a whitespace.
         if(reg != 1)
           ASTERIA_THROW_RUNTIME_ERROR(("Unpaired hexadecimal digit"));
 
         continue;
       }
-      reg <<= 4;
 
       // Decode a digit.
-      pos = do_xstrchr(s_base16_table, c);
-      if(!pos)
-        ASTERIA_THROW_RUNTIME_ERROR(("Invalid hexadecimal digit (character `$1`)"), c);
-
-      reg |= static_cast<uint32_t>(pos - s_base16_table) / 2;
+      reg <<= 4;
+      reg |= static_cast<uint32_t>(v);
 
       // Decode the current group if it is complete.
       if(!(reg & 0x1'00))
         continue;
 
-      data += static_cast<char>(reg);
+      *(wptr++) = static_cast<char>(reg);
       reg = 1;
     }
     if(reg != 1)
       ASTERIA_THROW_RUNTIME_ERROR(("Unpaired hexadecimal digit"));
 
+    data.erase(static_cast<size_t>(wptr - data.data()));
     return data;
   }
 
 V_string
 std_string_base32_encode(V_string data)
   {
+    // Allocate the result, which will be filled in place.
     V_string text;
-    text.reserve((data.size() + 4) / 5 * 8);
+    text.append((data.size() + 4) / 5 * 8, '*');
+    char* wptr = text.mut_data();
 
     // These shall be operated in big-endian order.
     uint64_t reg = 0;
@@ -1199,7 +2050,7 @@ std_string_base32_encode(V_string data)
       for(size_t i = 0;  i < 8;  ++i) {
         uint32_t b = (reg >> 58) & 0xFE;
         reg <<= 5;
-        text += s_base32_table[b];
+        *(wptr++) = s_base32_table[b];
       }
     }
     if(nread != data.size()) {
@@ -1219,20 +2070,25 @@ std_string_base32_encode(V_string data)
       for(size_t i = 0;  i < p;  ++i) {
         uint32_t b = (reg >> 58) & 0xFE;
         reg <<= 5;
-        text += s_base32_table[b];
+        *(wptr++) = s_base32_table[b];
       }
 
       // Fill padding characters.
       for(size_t i = p;  i != 8;  ++i)
-        text += s_base32_table[64];
+        *(wptr++) = s_base32_table[64];
     }
+    ROCKET_ASSERT(wptr == text.data() + text.size());
     return text;
   }
 
 V_string
 std_string_base32_decode(V_string text)
   {
+    // Allocate an upper bound of the result, which will be truncated in the
+    // end. Spaces and padding characters don't produce data.
     V_string data;
+    data.append(text.size() / 8 * 5, '*');
+    char* wptr = data.mut_data();
 
     // These shall be operated in big-endian order.
     uint64_t reg = 1;
@@ -1243,18 +2099,21 @@ std_string_base32_decode(V_string text)
     while(nread != text.size()) {
       // Read and identify a character.
       char c = text[nread++];
-      const char* pos = do_xstrchr(s_spaces, c);
-      if(pos) {
-        // The character is a whitespace.
-        if(reg != 1)
-          ASTERIA_THROW_RUNTIME_ERROR(("Incomplete base32 group"));
+      int v = s_base32_values[c];
+      if(v < 0) {
+        if(do_xstrchr(s_spaces, c)) {
+          // The character is a whitespace.
+          if(reg != 1)
+            ASTERIA_THROW_RUNTIME_ERROR(("Incomplete base32 group"));
+
+          continue;
+        }
 
-        continue;
-      }
-      reg <<= 5;
+        if(c != s_base32_table[64])
+          ASTERIA_THROW_RUNTIME_ERROR(("Invalid base32 digit (character `$1`)"), c);
 
-      if(c == s_base32_table[64]) {
         // The character is a padding character.
+        reg <<= 5;
         if(reg < 0x100)
           ASTERIA_THROW_RUNTIME_ERROR(("Unexpected base32 padding character"));
 
@@ -1262,14 +2121,11 @@ std_string_base32_decode(V_string text)
       }
       else {
         // Decode a digit.
-        pos = do_xstrchr(s_base32_table, c);
-        if(!pos)
-          ASTERIA_THROW_RUNTIME_ERROR(("Invalid base32 digit (character `$1`)"), c);
-
         if(npad != 0)
           ASTERIA_THROW_RUNTIME_ERROR(("Unexpected base32 digit following padding character"));
 
-        reg |= static_cast<uint32_t>(pos - s_base32_table) / 2;
+        reg <<= 5;
+        reg |= static_cast<uint32_t>(v);
       }
 
       // Decode the current group if it is complete.
@@ -1285,7 +2141,7 @@ std_string_base32_decode(V_string text)
 
       for(size_t i = 0; i < m; ++i) {
         reg <<= 8;
-        data += static_cast<char>(reg >> 40);
+        *(wptr++) = static_cast<char>(reg >> 40);
       }
       reg = 1;
       npad = 0;
@@ -1293,20 +2149,26 @@ std_string_base32_decode(V_string text)
     if(reg != 1)
       ASTERIA_THROW_RUNTIME_ERROR(("Incomplete base32 group"));
 
+    data.erase(static_cast<size_t>(wptr - data.data()));
     return data;
   }
 
 V_string
 std_string_base64_encode(V_string data)
   {
+    // Allocate the result, which will be filled in place.
     V_string text;
-    text.reserve((data.size() + 2) / 3 * 4);
+    text.append((data.size() + 2) / 3 * 4, '*');
+    char* wptr = text.mut_data();
+
+    // Encode source data in bulk.
+    size_t nread = do_base64_encode_bulk(wptr, data.data(), data.size());
+    wptr += nread / 3 * 4;
 
     // These shall be operated in big-endian order.
     uint32_t reg = 0;
 
-    // Encode source data.
-    size_t nread = 0;
+    // Encode remaining data.
     while(data.size() - nread >= 3) {
       // Read 3 consecutive bytes.
       for(size_t i = 0;  i < 3;  ++i) {
@@ -1320,7 +2182,7 @@ std_string_base64_encode(V_string data)
       for(size_t i = 0;  i < 4;  ++i) {
         uint32_t b = (reg >> 26) & 0xFF;
         reg <<= 6;
-        text += s_base64_table[b];
+        *(wptr++) = s_base64_table[b];
       }
     }
     if(nread != data.size()) {
@@ -1340,20 +2202,26 @@ std_string_base64_encode(V_string data)
       for(size_t i = 0;  i < p;  ++i) {
         uint32_t b = (reg >> 26) & 0xFF;
         reg <<= 6;
-        text += s_base64_table[b];
+        *(wptr++) = s_base64_table[b];
       }
 
       // Fill padding characters.
       for(size_t i = p;  i != 4;  ++i)
-        text += s_base64_table[64];
+        *(wptr++) = s_base64_table[64];
     }
+    ROCKET_ASSERT(wptr == text.data() + text.size());
     return text;
   }
 
 V_string
 std_string_base64_decode(V_string text)
   {
+    // Allocate an upper bound of the result, which will be truncated in the
+    // end. Spaces and padding characters don't produce data. As SIMD code may
+    // write a few bytes past the end, some extra space is reserved.
     V_string data;
+    data.append(text.size() / 4 * 3 + 16, '*');
+    char* wptr = data.mut_data();
 
     // These shall be operated in big-endian order.
     uint32_t reg = 1;
@@ -1362,20 +2230,32 @@ std_string_base64_decode(V_string text)
     // Decode source data.
     size_t nread = 0;
     while(nread != text.size()) {
+      // Decode digits in bulk, if this is the beginning of a group.
+      if(reg == 1) {
+        size_t n = do_base64_decode_bulk(wptr, text.data() + nread, text.size() - nread);
+        nread += n;
+        wptr += n / 4 * 3;
+        if(nread == text.size())
+          break;
+      }
+
       // Read and identify a character.
       char c = text[nread++];
-      const char* pos = do_xstrchr(s_spaces, c);
-      if(pos) {
-        // The character is a whitespace.
-        if(reg != 1)
-          ASTERIA_THROW_RUNTIME_ERROR(("Incomplete base64 group"));
+      int v = s_base64_values[c];
+      if(v < 0) {
+        if(do_xstrchr(s_spaces, c)) {
+          // The character is a whitespace.
+          if(reg != 1)
+            ASTERIA_THROW_RUNTIME_ERROR(("Incomplete base64 group"));
+
+          continue;
+        }
 
-        continue;
-      }
-      reg <<= 6;
+        if(c != s_base64_table[64])
+          ASTERIA_THROW_RUNTIME_ERROR(("Invalid base64 digit (character `$1`)"), c);
 
-      if(c == s_base64_table[64]) {
         // The character is a padding character.
+        reg <<= 6;
         if(reg < 0x100)
           ASTERIA_THROW_RUNTIME_ERROR(("Unexpected base64 padding character"));
 
@@ -1383,15 +2263,12 @@ std_string_base64_decode(V_string text)
       }
       else {
         // Decode a digit.
-        pos = do_xstrchr(s_base64_table, c);
-        if(!pos)
-          ASTERIA_THROW_RUNTIME_ERROR(("Invalid base64 digit (character `$1`)"), c);
-
         if(npad != 0)
           ASTERIA_THROW_RUNTIME_ERROR((
               "Unexpected base64 digit following padding character"));
 
-        reg |= static_cast<uint32_t>(pos - s_base64_table);
+        reg <<= 6;
+        reg |= static_cast<uint32_t>(v);
       }
 
       // Decode the current group if it is complete.
@@ -1407,7 +2284,7 @@ std_string_base64_decode(V_string text)
 
       for(size_t i = 0; i < m; ++i) {
         reg <<= 8;
-        data += static_cast<char>(reg >> 24);
+        *(wptr++) = static_cast<char>(reg >> 24);
       }
       reg = 1;
       npad = 0;
@@ -1415,174 +2292,38 @@ std_string_base64_decode(V_string text)
     if(reg != 1)
       ASTERIA_THROW_RUNTIME_ERROR(("Incomplete base64 group"));
 
+    data.erase(static_cast<size_t>(wptr - data.data()));
     return data;
   }
 
 V_string
 std_string_url_encode(V_string data)
   {
-    // Only modify the string as needed, without causing copies on write.
-    V_string text = data;
-    char pseq[4] = { "%" };
-    size_t nread = 0;
-    while(nread != text.size()) {
-      char c = text[nread++];
-
-      // Check for characters that don't need escaping.
-      if(((c >= '0') && (c <= '9')) || ((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z')))
-        continue;
-
-      if((c == '-') || (c == '_') || (c == '~') || (c == '.'))
-        continue;
-
-      // Escape it.
-      pseq[1] = s_base16_table[(c >> 3) & 0x1E];
-      pseq[2] = s_base16_table[(c << 1) & 0x1E];
-      text.replace(nread - 1, 1, pseq, 3);
-      nread += 2;
-    }
-    return text;
+    return do_url_encode(data, false);
   }
 
 V_string
 std_string_url_decode(V_string text)
   {
-    // Only modify the string as needed, without causing copies on write.
-    V_string data = text;
-    size_t nread = 0;
-    while(nread != data.size()) {
-      char c = data[nread++];
-
-      // Check for control characters and spaces.
-      if(((c >= 0) && (c <= ' ')) || (c == '\x7F') || (c == '\xFF'))
-        ASTERIA_THROW_RUNTIME_ERROR(("Invalid character in URL (character `$1`)"), (int) c);
-
-      // Check for a percent sign followed by two hexadecimal characters.
-      // Everything else is left intact.
-      if(c != '%')
-        continue;
-
-      if(data.size() - nread < 2)
-        ASTERIA_THROW_RUNTIME_ERROR(("No enough hexadecimal digits after `%`"));
-
-      // Parse the first digit.
-      c = data[nread++];
-      const char* pos_hi = do_xstrchr(s_base16_table, c);
-      if(!pos_hi)
-        ASTERIA_THROW_RUNTIME_ERROR(("Invalid hexadecimal digit (character `$1`)"), c);
-
-      // Parse the second digit.
-      c = data[nread++];
-      auto pos_lo = do_xstrchr(s_base16_table, c);
-      if(!pos_lo)
-        ASTERIA_THROW_RUNTIME_ERROR(("Invalid hexadecimal digit (character `$1`)"), c);
-
-      // Compose the byte.
-      ptrdiff_t value = (pos_hi - s_base16_table) / 2 * 16;
-      value += (pos_lo - s_base16_table) / 2;
-
-      // Replace this sequence with the decoded byte.
-      nread -= 2;
-      data.replace(nread - 1, 3, 1, static_cast<char>(value));
-    }
-    return data;
+    return do_url_decode(text, false);
   }
 
 V_string
 std_string_url_query_encode(V_string data)
   {
-    // Only modify the string as needed, without causing copies on write.
-    V_string text = data;
-    char pseq[4] = { "%" };
-    size_t nread = 0;
-    while(nread != text.size()) {
-      char c = text[nread++];
-
-      // Check for characters that don't need escaping.
-      if(((c >= '0') && (c <= '9')) || ((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z')))
-        continue;
-
-      if((c == '-') || (c == '_') || (c == '.'))
-        continue;
-
-      // Encode spaces specially.
-      if(c == ' ') {
-        text.mut(nread - 1) = '+';
-        continue;
-      }
-
-      // Escape it.
-      pseq[1] = s_base16_table[(c >> 3) & 0x1E];
-      pseq[2] = s_base16_table[(c << 1) & 0x1E];
-      text.replace(nread - 1, 1, pseq, 3);
-      nread += 2;
-    }
-    return text;
+    return do_url_encode(data, true);
   }
 
 V_string
 std_string_url_query_decode(V_string text)
   {
-    // Only modify the string as needed, without causing copies on write.
-    V_string data = text;
-    size_t nread = 0;
-    while(nread != data.size()) {
-      char c = data[nread++];
-
-      // Check for control characters and spaces.
-      if(((c >= 0) && (c <= ' ')) || (c == '\x7F') || (c == '\xFF'))
-        ASTERIA_THROW_RUNTIME_ERROR(("Invalid character in URL (character `$1`)"), (int) c);
-
-      // Decode spaces specially.
-      if(c == '+') {
-        data.mut(nread - 1) = ' ';
-        continue;
-      }
-
-      // Check for a percent sign followed by two hexadecimal characters.
-      // Everything else is left intact.
-      if(c != '%')
-        continue;
-
-      // Two hexadecimal characters shall follow.
-      if(data.size() - nread < 2)
-        ASTERIA_THROW_RUNTIME_ERROR(("No enough hexadecimal digits after `%`"));
-
-      // Parse the first digit.
-      c = data[nread++];
-      const char* pos_hi = do_xstrchr(s_base16_table, c);
-      if(!pos_hi)
-        ASTERIA_THROW_RUNTIME_ERROR(("Invalid hexadecimal digit (character `$1`)"), c);
-
-      // Parse the second digit.
-      c = data[nread++];
-      auto pos_lo = do_xstrchr(s_base16_table, c);
-      if(!pos_lo)
-        ASTERIA_THROW_RUNTIME_ERROR(("Invalid hexadecimal digit (character `$1`)"), c);
-
-      // Compose the byte.
-      ptrdiff_t value = (pos_hi - s_base16_table) / 2 * 16;
-      value += (pos_lo - s_base16_table) / 2;
-
-      // Replace this sequence with the decoded byte.
-      nread -= 2;
-      data.replace(nread - 1, 3, 1, static_cast<char>(value));
-    }
-    return data;
+    return do_url_decode(text, true);
   }
 
 V_boolean
 std_string_utf8_validate(V_string text)
   {
-    size_t offset = 0;
-    while(offset < text.size()) {
-      // Try decoding a code point.
-      char32_t cp;
-      if(!utf8_decode(cp, text, offset))
-        // This sequence is invalid.
-        return false;
-    }
-    return true;
+    return utf8_valid_prefix_length(text.data(), text.size()) == text.size();
   }
 
 V_string
@@ -1631,6 +2372,15 @@ std_string_utf8_decode(V_string text, optV_boolean permissive)
 
     size_t offset = 0;
     while(offset < text.size()) {
+      // ASCII characters need no decoding.
+      size_t nascii = ascii_prefix_length(text.data() + offset, text.size() - offset);
+      for(size_t k = offset;  k != offset + nascii;  ++k)
+        code_points.emplace_back(V_integer(text[k]));
+
+      offset += nascii;
+      if(offset == text.size())
+        break;
+
       // Try decoding a code point.
       char32_t cp;
       if(!utf8_decode(cp, text, offset)) {
@@ -1679,7 +2429,9 @@ std_string_PCRE(V_string pattern, optV_array options)
 V_opaque
 std_string_PCRE_private(V_string pattern, optV_array options)
   {
-    return ::rocket::make_refcnt<PCRE2_Matcher>(pattern, options);
+    bool jit = false;
+    uint32_t opts = do_parse_pcre2_options(jit, options);
+    return ::rocket::make_refcnt<PCRE2_Matcher>(pattern, opts, jit);
   }
 
 opt<pair<V_integer, V_integer>>
@@ -1707,31 +2459,49 @@ std_string_PCRE_replace(V_opaque& m, V_string text, V_integer from, optV_integer
   }
 
 opt<pair<V_integer, V_integer>>
-std_string_pcre_find(V_string text, V_integer from, optV_integer length, V_string pattern, optV_array options)
+std_string_pcre_find(Global_Context& global, V_string text, V_integer from, optV_integer length, V_string pattern, optV_array options)
   {
-    PCRE2_Matcher m(pattern, options);
-    return m.find(text, from, length);
+    auto ptr = do_get_cached_PCRE(global, pattern, options);
+    return static_cast<PCRE2_Matcher&>(*ptr).find(text, from, length);
   }
 
 optV_array
-std_string_pcre_match(V_string text, V_integer from, optV_integer length, V_string pattern, optV_array options)
+std_string_pcre_match(Global_Context& global, V_string text, V_integer from, optV_integer length, V_string pattern, optV_array options)
   {
-    PCRE2_Matcher m(pattern, options);
-    return m.match(text, from, length);
+    auto ptr = do_get_cached_PCRE(global, pattern, options);
+    return static_cast<PCRE2_Matcher&>(*ptr).match(text, from, length);
   }
 
 optV_object
-std_string_pcre_named_match(V_string text, V_integer from, optV_integer length, V_string pattern, optV_array options)
+std_string_pcre_named_match(Global_Context& global, V_string text, V_integer from, optV_integer length, V_string pattern, optV_array options)
   {
-    PCRE2_Matcher m(pattern, options);
-    return m.named_match(text, from, length);
+    auto ptr = do_get_cached_PCRE(global, pattern, options);
+    return static_cast<PCRE2_Matcher&>(*ptr).named_match(text, from, length);
   }
 
 V_string
-std_string_pcre_replace(V_string text, V_integer from, optV_integer length, V_string pattern, V_string replacement, optV_array options)
+std_string_pcre_replace(Global_Context& global, V_string text, V_integer from, optV_integer length, V_string pattern, V_string replacement, optV_array options)
+  {
+    auto ptr = do_get_cached_PCRE(global, pattern, options);
+    return static_cast<PCRE2_Matcher&>(*ptr).replace(text, from, length, replacement);
+  }
+
+V_object
+std_string_pcre_cache_stats(Global_Context& global)
+  {
+    const auto cache = global.regex_cache();
+    V_object result;
+    result.try_emplace(sref("hits"), static_cast<V_integer>(cache->hits()));
+    result.try_emplace(sref("misses"), static_cast<V_integer>(cache->misses()));
+    result.try_emplace(sref("size"), static_cast<V_integer>(cache->size()));
+    result.try_emplace(sref("capacity"), static_cast<V_integer>(cache->capacity()));
+    return result;
+  }
+
+void
+std_string_pcre_cache_clear(Global_Context& global)
   {
-    PCRE2_Matcher m(pattern, options);
-    return m.replace(text, from, length, replacement);
+    global.regex_cache()->clear();
   }
 
 V_string
@@ -2547,7 +3317,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
     result.insert_or_assign(sref("pcre_find"),
       ASTERIA_BINDING(
         "std.string.pcre_find", "text, [from, [length]], pattern, [options]",
-        Argument_Reader&& reader)
+        Global_Context& global, Argument_Reader&& reader)
       {
         V_string text, patt;
         V_integer from;
@@ -2560,7 +3330,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
         reader.required(patt);
         reader.optional(opts);
         if(reader.end_overload())
-          return (Value) std_string_pcre_find(text, 0, nullopt, patt, opts);
+          return (Value) std_string_pcre_find(global, text, 0, nullopt, patt, opts);
 
         reader.load_state(0);
         reader.required(from);
@@ -2568,14 +3338,14 @@ create_bindings_string(V_object& result, API_Version /*version*/)
         reader.required(patt);
         reader.optional(opts);
         if(reader.end_overload())
-          return (Value) std_string_pcre_find(text, from, nullopt, patt, opts);
+          return (Value) std_string_pcre_find(global, text, from, nullopt, patt, opts);
 
         reader.load_state(0);
         reader.optional(len);
         reader.required(patt);
         reader.optional(opts);
         if(reader.end_overload())
-          return (Value) std_string_pcre_find(text, from, len, patt, opts);
+          return (Value) std_string_pcre_find(global, text, from, len, patt, opts);
 
         reader.throw_no_matching_function_call();
       });
@@ -2583,7 +3353,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
     result.insert_or_assign(sref("pcre_match"),
       ASTERIA_BINDING(
         "std.string.pcre_match", "text, [from, [length]], pattern, [options]",
-        Argument_Reader&& reader)
+        Global_Context& global, Argument_Reader&& reader)
       {
         V_string text, patt;
         V_integer from;
@@ -2596,7 +3366,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
         reader.required(patt);
         reader.optional(opts);
         if(reader.end_overload())
-          return (Value) std_string_pcre_match(text, 0, nullopt, patt, opts);
+          return (Value) std_string_pcre_match(global, text, 0, nullopt, patt, opts);
 
         reader.load_state(0);
         reader.required(from);
@@ -2604,14 +3374,14 @@ create_bindings_string(V_object& result, API_Version /*version*/)
         reader.required(patt);
         reader.optional(opts);
         if(reader.end_overload())
-          return (Value) std_string_pcre_match(text, from, nullopt, patt, opts);
+          return (Value) std_string_pcre_match(global, text, from, nullopt, patt, opts);
 
         reader.load_state(0);
         reader.optional(len);
         reader.required(patt);
         reader.optional(opts);
         if(reader.end_overload())
-          return (Value) std_string_pcre_match(text, from, len, patt, opts);
+          return (Value) std_string_pcre_match(global, text, from, len, patt, opts);
 
         reader.throw_no_matching_function_call();
       });
@@ -2619,7 +3389,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
     result.insert_or_assign(sref("pcre_named_match"),
       ASTERIA_BINDING(
         "std.string.pcre_named_match", "text, [from, [length]], pattern, [options]",
-        Argument_Reader&& reader)
+        Global_Context& global, Argument_Reader&& reader)
       {
         V_string text, patt;
         V_integer from;
@@ -2632,7 +3402,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
         reader.required(patt);
         reader.optional(opts);
         if(reader.end_overload())
-          return (Value) std_string_pcre_named_match(text, 0, nullopt, patt, opts);
+          return (Value) std_string_pcre_named_match(global, text, 0, nullopt, patt, opts);
 
         reader.load_state(0);
         reader.required(from);
@@ -2640,14 +3410,14 @@ create_bindings_string(V_object& result, API_Version /*version*/)
         reader.required(patt);
         reader.optional(opts);
         if(reader.end_overload())
-          return (Value) std_string_pcre_named_match(text, from, nullopt, patt, opts);
+          return (Value) std_string_pcre_named_match(global, text, from, nullopt, patt, opts);
 
         reader.load_state(0);
         reader.optional(len);
         reader.required(patt);
         reader.optional(opts);
         if(reader.end_overload())
-          return (Value) std_string_pcre_named_match(text, from, len, patt, opts);
+          return (Value) std_string_pcre_named_match(global, text, from, len, patt, opts);
 
         reader.throw_no_matching_function_call();
       });
@@ -2655,7 +3425,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
     result.insert_or_assign(sref("pcre_replace"),
       ASTERIA_BINDING(
         "std.string.pcre_replace", "text, [from, [length]], pattern, replacement, [options]",
-        Argument_Reader&& reader)
+        Global_Context& global, Argument_Reader&& reader)
       {
         V_string text, patt, rep;
         V_integer from;
@@ -2669,7 +3439,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
         reader.required(rep);
         reader.optional(opts);
         if(reader.end_overload())
-          return (Value) std_string_pcre_replace(text, 0, nullopt, patt, rep, opts);
+          return (Value) std_string_pcre_replace(global, text, 0, nullopt, patt, rep, opts);
 
         reader.load_state(0);
         reader.required(from);
@@ -2678,7 +3448,7 @@ create_bindings_string(V_object& result, API_Version /*version*/)
         reader.required(rep);
         reader.optional(opts);
         if(reader.end_overload())
-          return (Value) std_string_pcre_replace(text, from, nullopt, patt, rep, opts);
+          return (Value) std_string_pcre_replace(global, text, from, nullopt, patt, rep, opts);
 
         reader.load_state(0);
         reader.optional(len);
@@ -2686,7 +3456,31 @@ create_bindings_string(V_object& result, API_Version /*version*/)
         reader.required(rep);
         reader.optional(opts);
         if(reader.end_overload())
-          return (Value) std_string_pcre_replace(text, from, len, patt, rep, opts);
+          return (Value) std_string_pcre_replace(global, text, from, len, patt, rep, opts);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("pcre_cache_stats"),
+      ASTERIA_BINDING(
+        "std.string.pcre_cache_stats", "",
+        Global_Context& global, Argument_Reader&& reader)
+      {
+        reader.start_overload();
+        if(reader.end_overload())
+          return (Value) std_string_pcre_cache_stats(global);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("pcre_cache_clear"),
+      ASTERIA_BINDING(
+        "std.string.pcre_cache_clear", "",
+        Global_Context& global, Argument_Reader&& reader)
+      {
+        reader.start_overload();
+        if(reader.end_overload())
+          return (void) std_string_pcre_cache_clear(global);
 
         reader.throw_no_matching_function_call();
       });
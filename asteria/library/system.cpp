@@ -9,6 +9,7 @@
 #include "../runtime/global_context.hpp"
 #include "../runtime/garbage_collector.hpp"
 #include "../runtime/random_engine.hpp"
+#include "../runtime/instantiated_function.hpp"
 #include "../compiler/token_stream.hpp"
 #include "../compiler/compiler_error.hpp"
 #include "../compiler/enums.hpp"
@@ -368,6 +369,20 @@ std_system_get_properties()
     return names;
   }
 
+V_object
+std_system_count_functions()
+  {
+    // Read `compiled` first, so `uncompiled` will never be negative.
+    int64_t compiled = Instantiated_Function::count_solidified();
+    int64_t instantiated = Instantiated_Function::count_instantiated();
+
+    V_object result;
+    result.try_emplace(sref("instantiated"), V_integer(instantiated));
+    result.try_emplace(sref("compiled"), V_integer(compiled));
+    result.try_emplace(sref("uncompiled"), V_integer(instantiated - compiled));
+    return result;
+  }
+
 V_string
 std_system_uuid(Global_Context& global)
   {
@@ -557,7 +572,7 @@ std_system_conf_load_file(V_string path)
 
     Token_Stream tstrm(opts);
     ::rocket::tinybuf_file cbuf(path.safe_c_str(), tinybuf::open_read);
-    tstrm.reload(path, 1, ::std::move(cbuf));
+    tstrm.reload(path, 1, cbuf);
 
     Xparse_object ctxo;
     while(!tstrm.empty()) {
@@ -681,6 +696,18 @@ create_bindings_system(V_object& result, API_Version /*version*/)
         reader.throw_no_matching_function_call();
       });
 
+    result.insert_or_assign(sref("count_functions"),
+      ASTERIA_BINDING(
+        "std.system.count_functions", "",
+        Argument_Reader&& reader)
+      {
+        reader.start_overload();
+        if(reader.end_overload())
+          return (Value) std_system_count_functions();
+
+        reader.throw_no_matching_function_call();
+      });
+
     result.insert_or_assign(sref("uuid"),
       ASTERIA_BINDING(
         "std.system.uuid", "",
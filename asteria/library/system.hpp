@@ -35,6 +35,10 @@ std_system_env_get_variables();
 V_object
 std_system_get_properties();
 
+// `std.system.count_functions`
+V_object
+std_system_count_functions();
+
 // `std.system.uuid`
 V_string
 std_system_uuid(Global_Context& global);
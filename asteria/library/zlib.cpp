@@ -97,6 +97,21 @@ class Deflator final
         ::deflateReset(this->m_strm);
       }
 
+    size_t
+    bound(size_t size) noexcept
+      {
+        return ::deflateBound(this->m_strm, static_cast<::uLong>(size));
+      }
+
+    void
+    set_dictionary(const void* data, size_t size)
+      {
+        int err = ::deflateSetDictionary(this->m_strm, static_cast<const ::Byte*>(data),
+                                         static_cast<::uInt>(size));
+        if(err != Z_OK)
+          do_zlib_throw_error("deflateSetDictionary", this->m_strm, err);
+      }
+
     void
     update(V_string& out, const void* data, size_t size)
       {
@@ -289,9 +304,11 @@ class Inflator final
         ::inflateReset(this->m_strm);
       }
 
-    void
+    size_t
     update(V_string& out, const void* data, size_t size)
       {
+        // Input after the end of the stream is not consumed. The number of
+        // bytes that have been consumed is returned.
         auto& bptr = this->m_strm->next_in;
         bptr = static_cast<const ::Byte*>(data);
         auto eptr = bptr + size;
@@ -308,6 +325,7 @@ class Inflator final
           else if(err != Z_OK)
             do_zlib_throw_error("inflate", this->m_strm, err);
         }
+        return static_cast<size_t>(bptr - static_cast<const ::Byte*>(data));
       }
 
     void
@@ -456,6 +474,613 @@ do_level(const optV_integer& level)
                Z_NO_COMPRESSION, Z_BEST_COMPRESSION);
   }
 
+void
+do_write_all(int fd, const char* data, size_t size, const cow_string& path)
+  {
+    size_t off = 0;
+    while(off != size) {
+      ::ssize_t nwrtn = ::write(fd, data + off, size - off);
+      if(nwrtn < 0)
+        ASTERIA_THROW_RUNTIME_ERROR((
+            "Error writing file '$1'",
+            "[`write()` failed: ${errno:full}]"),
+            path);
+
+      off += static_cast<size_t>(nwrtn);
+    }
+  }
+
+class Gzip_File_Writer final
+  :
+    public Abstract_Opaque
+  {
+  private:
+    static constexpr size_t s_buffer_size = 0x40000;
+
+    ::z_stream m_strm[1] = { };
+    ::rocket::unique_posix_fd m_fd;
+    cow_string m_path;
+    unique_ptr<char, void (void*)> m_buf;
+
+  public:
+    explicit
+    Gzip_File_Writer(const cow_string& path, int level)
+      :
+        m_path(path), m_buf(::operator delete)
+      {
+        this->m_fd.reset(::open(path.safe_c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666));
+        if(!this->m_fd)
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Could not open file '$1'",
+              "[`open()` failed: ${errno:full}]"),
+              path);
+
+        int err = ::deflateInit2(this->m_strm, level, Z_DEFLATED, 31, 9, 0);
+        if(err != Z_OK)
+          do_zlib_throw_error("deflateInit2", this->m_strm, err);
+
+        // Compressed data are written in large blocks.
+        this->m_buf.reset(static_cast<char*>(::operator new(s_buffer_size)));
+        this->m_strm->next_out = reinterpret_cast<::Byte*>(this->m_buf.get());
+        this->m_strm->avail_out = s_buffer_size;
+      }
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(Gzip_File_Writer)
+      {
+        // Try finishing the stream, like `fclose()`. Errors are ignored.
+        if(this->m_fd)
+          try {
+            this->close();
+          }
+          catch(exception&) { }
+
+        ::deflateEnd(this->m_strm);
+      }
+
+  private:
+    void
+    do_check_open() const
+      {
+        if(!this->m_fd)
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Gzip file '$1' has been closed"),
+              this->m_path);
+      }
+
+    void
+    do_write_buffer(int fd)
+      {
+        size_t size = s_buffer_size - this->m_strm->avail_out;
+        do_write_all(fd, this->m_buf, size, this->m_path);
+        this->m_strm->next_out = reinterpret_cast<::Byte*>(this->m_buf.get());
+        this->m_strm->avail_out = s_buffer_size;
+      }
+
+    int
+    do_deflate(int fd, int flush)
+      {
+        int err = ::deflate(this->m_strm, flush);
+        if((err != Z_OK) && (err != Z_STREAM_END) && (err != Z_BUF_ERROR))
+          do_zlib_throw_error("deflate", this->m_strm, err);
+
+        if(this->m_strm->avail_out == 0)
+          this->do_write_buffer(fd);
+        return err;
+      }
+
+  public:
+    tinyfmt&
+    describe(tinyfmt& fmt) const override
+      {
+        return format(fmt, "instance of `std.zlib.GzipWriter` at `$1`", this);
+      }
+
+    void
+    collect_variables(Variable_HashMap&, Variable_HashMap&) const override
+      {
+      }
+
+    Gzip_File_Writer*
+    clone_opt(refcnt_ptr<Abstract_Opaque>&) const override
+      {
+        // All copies share the same file.
+        return nullptr;
+      }
+
+    void
+    write(const void* data, size_t size)
+      {
+        this->do_check_open();
+
+        auto& bptr = this->m_strm->next_in;
+        bptr = static_cast<const ::Byte*>(data);
+        auto eptr = bptr + size;
+
+        for(;;) {
+          ::uInt in = ::rocket::clamp_cast<::uInt>(eptr - bptr, 0, INT_MAX);
+          this->m_strm->avail_in = in;
+          if(in == 0)
+            break;
+
+          this->do_deflate(this->m_fd, Z_NO_FLUSH);
+        }
+      }
+
+    void
+    flush()
+      {
+        this->do_check_open();
+
+        // Complete all pending output, and write it.
+        this->m_strm->next_in = nullptr;
+        this->m_strm->avail_in = 0;
+        while(this->do_deflate(this->m_fd, Z_SYNC_FLUSH) != Z_BUF_ERROR);
+        this->do_write_buffer(this->m_fd);
+      }
+
+    void
+    close()
+      {
+        this->do_check_open();
+
+        // Detach the file first. If the final write fails, the stream cannot
+        // be finished again, and the destructor must not write the same data
+        // twice.
+        ::rocket::unique_posix_fd fd(this->m_fd.release());
+
+        this->m_strm->next_in = nullptr;
+        this->m_strm->avail_in = 0;
+        while(this->do_deflate(fd, Z_FINISH) != Z_STREAM_END);
+        this->do_write_buffer(fd);
+
+        if(::close(fd.release()) != 0)
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Error closing file '$1'",
+              "[`close()` failed: ${errno:full}]"),
+              this->m_path);
+      }
+  };
+
+void
+do_construct_Gzip_File_Writer(V_object& result, const V_string& path, const optV_integer& level)
+  {
+    static constexpr auto s_private_uuid = sref("{3A0E6C52-91B7-4D3E-0A48-7F2C5E1D09B3}");
+    result.insert_or_assign(s_private_uuid,
+           ::rocket::make_refcnt<Gzip_File_Writer>(path, do_level(level)));
+
+    result.insert_or_assign(sref("write"),
+      ASTERIA_BINDING(
+        "std.zlib.GzipWriter::write", "data",
+        Reference&& self, Argument_Reader&& reader)
+      {
+        auto& writer = self.dereference_mutable().mut_object().mut(s_private_uuid).mut_opaque();
+        V_string data;
+
+        reader.start_overload();
+        reader.required(data);
+        if(reader.end_overload())
+          return (void) std_zlib_GzipWriter_write(writer, data);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("flush"),
+      ASTERIA_BINDING(
+        "std.zlib.GzipWriter::flush", "",
+        Reference&& self, Argument_Reader&& reader)
+      {
+        auto& writer = self.dereference_mutable().mut_object().mut(s_private_uuid).mut_opaque();
+
+        reader.start_overload();
+        if(reader.end_overload())
+          return (void) std_zlib_GzipWriter_flush(writer);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("close"),
+      ASTERIA_BINDING(
+        "std.zlib.GzipWriter::close", "",
+        Reference&& self, Argument_Reader&& reader)
+      {
+        auto& writer = self.dereference_mutable().mut_object().mut(s_private_uuid).mut_opaque();
+
+        reader.start_overload();
+        if(reader.end_overload())
+          return (void) std_zlib_GzipWriter_close(writer);
+
+        reader.throw_no_matching_function_call();
+      });
+  }
+
+class Gzip_File_Reader final
+  :
+    public Abstract_Opaque
+  {
+  private:
+    static constexpr size_t s_buffer_size = 0x40000;
+
+    ::z_stream m_strm[1] = { };
+    ::rocket::unique_posix_fd m_fd;
+    cow_string m_path;
+    unique_ptr<char, void (void*)> m_buf;
+    bool m_input_eof = false;
+    bool m_output_eof = false;
+    bool m_in_member = false;
+    bool m_seen_member = false;
+
+  public:
+    explicit
+    Gzip_File_Reader(const cow_string& path)
+      :
+        m_path(path), m_buf(::operator delete)
+      {
+        this->m_fd.reset(::open(path.safe_c_str(), O_RDONLY));
+        if(!this->m_fd)
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Could not open file '$1'",
+              "[`open()` failed: ${errno:full}]"),
+              path);
+
+        int err = ::inflateInit2(this->m_strm, 31);
+        if(err != Z_OK)
+          do_zlib_throw_error("inflateInit2", this->m_strm, err);
+
+        this->m_buf.reset(static_cast<char*>(::operator new(s_buffer_size)));
+      }
+
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(Gzip_File_Reader)
+      {
+        ::inflateEnd(this->m_strm);
+      }
+
+  private:
+    void
+    do_check_open() const
+      {
+        if(!this->m_fd)
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Gzip file '$1' has been closed"),
+              this->m_path);
+      }
+
+    bool
+    do_fill_input()
+      {
+        // Compressed data are read in large blocks.
+        if(this->m_input_eof)
+          return false;
+
+        // Pending input is moved to the beginning of the buffer and kept.
+        size_t npend = this->m_strm->avail_in;
+        if(npend != 0)
+          ::memmove(this->m_buf, this->m_strm->next_in, npend);
+
+        ::ssize_t nread = ::read(this->m_fd, this->m_buf.get() + npend, s_buffer_size - npend);
+        if(nread < 0)
+          ASTERIA_THROW_RUNTIME_ERROR((
+              "Error reading file '$1'",
+              "[`read()` failed: ${errno:full}]"),
+              this->m_path);
+
+        this->m_strm->next_in = reinterpret_cast<::Byte*>(this->m_buf.get());
+        this->m_strm->avail_in = static_cast<::uInt>(npend + static_cast<size_t>(nread));
+        this->m_input_eof = nread == 0;
+        return nread != 0;
+      }
+
+  public:
+    tinyfmt&
+    describe(tinyfmt& fmt) const override
+      {
+        return format(fmt, "instance of `std.zlib.GzipReader` at `$1`", this);
+      }
+
+    void
+    collect_variables(Variable_HashMap&, Variable_HashMap&) const override
+      {
+      }
+
+    Gzip_File_Reader*
+    clone_opt(refcnt_ptr<Abstract_Opaque>&) const override
+      {
+        // All copies share the same file.
+        return nullptr;
+      }
+
+    bool
+    read(V_string& out, size_t limit)
+      {
+        this->do_check_open();
+
+        while(!this->m_output_eof && (out.size() < limit)) {
+          if((this->m_strm->avail_in == 0) && !this->do_fill_input()) {
+            // The file shall not end in the middle of a member.
+            if(this->m_in_member || !this->m_seen_member)
+              ASTERIA_THROW_RUNTIME_ERROR((
+                  "Unexpected end of gzip file '$1'"),
+                  this->m_path);
+
+            this->m_output_eof = true;
+            break;
+          }
+
+          if(!this->m_in_member) {
+            // Data after the last member are ignored, unless they start with
+            // the gzip magic number `1F 8B`, like `gunzip()`. The magic number
+            // may be split across two reads.
+            while((this->m_strm->avail_in < 2) && this->do_fill_input());
+
+            if(this->m_seen_member && ((this->m_strm->avail_in < 2)
+                   || (::memcmp(this->m_strm->next_in, "\x1F\x8B", 2) != 0))) {
+              this->m_output_eof = true;
+              break;
+            }
+
+            ::inflateReset(this->m_strm);
+            this->m_in_member = true;
+            this->m_seen_member = true;
+          }
+
+          // Decompress data into the output string directly.
+          size_t size_add = ::std::min<size_t>(limit - out.size(), 0x10000);
+          auto ipos = out.insert(out.end(), size_add, '*');
+          this->m_strm->next_out = reinterpret_cast<::Byte*>(&*ipos);
+          this->m_strm->avail_out = static_cast<::uInt>(size_add);
+
+          int err = ::inflate(this->m_strm, Z_NO_FLUSH);
+          ipos += static_cast<ptrdiff_t>(size_add - this->m_strm->avail_out);
+          out.erase(ipos, out.end());
+
+          if(err == Z_STREAM_END)
+            this->m_in_member = false;
+          else if((err != Z_OK) && (err != Z_BUF_ERROR))
+            do_zlib_throw_error("inflate", this->m_strm, err);
+        }
+        return !out.empty() || !this->m_output_eof;
+      }
+
+    void
+    close()
+      {
+        this->do_check_open();
+        this->m_fd.reset();
+      }
+  };
+
+void
+do_construct_Gzip_File_Reader(V_object& result, const V_string& path)
+  {
+    static constexpr auto s_private_uuid = sref("{3A0E6C57-2D84-4B61-0A48-E3906A7F51C8}");
+    result.insert_or_assign(s_private_uuid,
+           ::rocket::make_refcnt<Gzip_File_Reader>(path));
+
+    result.insert_or_assign(sref("read"),
+      ASTERIA_BINDING(
+        "std.zlib.GzipReader::read", "[limit]",
+        Reference&& self, Argument_Reader&& reader)
+      {
+        auto& gz_reader = self.dereference_mutable().mut_object().mut(s_private_uuid).mut_opaque();
+        optV_integer limit;
+
+        reader.start_overload();
+        reader.optional(limit);
+        if(reader.end_overload())
+          return (Value) std_zlib_GzipReader_read(gz_reader, limit);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("close"),
+      ASTERIA_BINDING(
+        "std.zlib.GzipReader::close", "",
+        Reference&& self, Argument_Reader&& reader)
+      {
+        auto& gz_reader = self.dereference_mutable().mut_object().mut(s_private_uuid).mut_opaque();
+
+        reader.start_overload();
+        if(reader.end_overload())
+          return (void) std_zlib_GzipReader_close(gz_reader);
+
+        reader.throw_no_matching_function_call();
+      });
+  }
+
+void
+do_append_le32(V_string& out, uint32_t val)
+  {
+    for(int k = 0;  k != 4;  ++k)
+      out.push_back(static_cast<char>(val >> k * 8));
+  }
+
+uint32_t
+do_load_le32(const char* ptr) noexcept
+  {
+    uint32_t val = 0;
+    for(int k = 3;  k >= 0;  --k)
+      val = val << 8 | static_cast<uint8_t>(ptr[k]);
+    return val;
+  }
+
+V_string
+do_deflate_parallel(const V_string& data, int wbits, int level, size_t nthreads)
+  {
+    // Split input into blocks, which are compressed on worker threads as raw
+    // streams, and then concatenated. Each block is primed with the last 32
+    // KiB of its predecessor, so the ratio is almost the same as a single
+    // stream. All blocks but the last end with a sync flush, so they are
+    // byte-aligned and not marked final.
+    constexpr size_t block_size = 0x20000;
+    constexpr size_t dict_size = 0x8000;
+    const size_t nblocks = (data.size() + block_size - 1) / block_size;
+    const bool gzip = wbits > 15;
+
+    cow_vector<V_string> blocks;
+    blocks.append(nblocks);
+    V_string* pblocks = blocks.mut_data();
+
+    cow_vector<uint32_t> sums;
+    sums.append(nblocks);
+    uint32_t* psums = sums.mut_data();
+
+    parallel_for_each(nblocks, nthreads,
+        [&](size_t k) {
+          const char* bptr = data.data() + k * block_size;
+          size_t len = ::std::min(block_size, data.size() - k * block_size);
+          auto ubptr = reinterpret_cast<const ::Byte*>(bptr);
+
+          if(gzip)
+            psums[k] = static_cast<uint32_t>(::crc32_z(0, ubptr, len));
+          else
+            psums[k] = static_cast<uint32_t>(::adler32_z(1, ubptr, len));
+
+          Deflator defl(-15, level);
+          if(k != 0)
+            defl.set_dictionary(bptr - dict_size, dict_size);
+
+          pblocks[k].reserve(defl.bound(len) + 16);
+          defl.update(pblocks[k], bptr, len);
+          if(k + 1 != nblocks)
+            defl.flush(pblocks[k]);
+          else
+            defl.finish(pblocks[k]);
+        });
+
+    // Combine checksums of blocks.
+    uint32_t sum = sums[0];
+    for(size_t k = 1;  k != nblocks;  ++k) {
+      auto len = static_cast<::z_off_t>(::std::min(block_size, data.size() - k * block_size));
+      if(gzip)
+        sum = static_cast<uint32_t>(::crc32_combine(sum, sums[k], len));
+      else
+        sum = static_cast<uint32_t>(::adler32_combine(sum, sums[k], len));
+    }
+
+    size_t total = 18;
+    for(const auto& block : blocks)
+      total += block.size();
+
+    V_string output;
+    output.reserve(total);
+    int eff_level = (level == Z_DEFAULT_COMPRESSION) ? 6 : level;
+
+    if(gzip) {
+      // Write a header without a file name or modification time, like zlib.
+      output.append("\x1F\x8B\x08\x00\x00\x00\x00\x00", 8);
+      output.push_back((eff_level == 9) ? '\x02' : (eff_level < 2) ? '\x04' : '\x00');
+      output.push_back('\x03');
+    }
+    else {
+      uint32_t header = 0x7800;
+      header |= static_cast<uint32_t>((eff_level < 2) ? 0 : (eff_level < 6) ? 1 : (eff_level == 6) ? 2 : 3) << 6;
+      header += 31 - header % 31;
+      output.push_back(static_cast<char>(header >> 8));
+      output.push_back(static_cast<char>(header));
+    }
+
+    for(const auto& block : blocks)
+      output.append(block);
+
+    if(gzip) {
+      do_append_le32(output, sum);
+      do_append_le32(output, static_cast<uint32_t>(data.size()));
+    }
+    else {
+      for(int k = 3;  k >= 0;  --k)
+        output.push_back(static_cast<char>(sum >> k * 8));
+    }
+    return output;
+  }
+
+bool
+do_gzip_member_size(size_t& size, const char* ptr, size_t avail) noexcept
+  {
+    // Some writers, such as BGZF, record the size of each member in an extra
+    // field, which allows members to be located without decompression.
+    if((avail < 18) || (::memcmp(ptr, "\x1F\x8B\x08", 3) != 0) || !(ptr[3] & 0x04))
+      return false;
+
+    size_t xlen = static_cast<uint8_t>(ptr[10]) | static_cast<size_t>(static_cast<uint8_t>(ptr[11])) << 8;
+    if(12 + xlen > avail)
+      return false;
+
+    size_t off = 12;
+    while(off + 4 <= 12 + xlen) {
+      size_t slen = static_cast<uint8_t>(ptr[off + 2]) | static_cast<size_t>(static_cast<uint8_t>(ptr[off + 3])) << 8;
+      if((ptr[off] == 'B') && (ptr[off + 1] == 'C') && (slen == 2) && (off + 6 <= 12 + xlen)) {
+        size = (static_cast<uint8_t>(ptr[off + 4]) | static_cast<size_t>(static_cast<uint8_t>(ptr[off + 5])) << 8) + 1;
+        return (size >= 12 + xlen + 8) && (size <= avail);
+      }
+      off += 4 + slen;
+    }
+    return false;
+  }
+
+void
+do_gunzip_sequential(V_string& output, const V_string& data)
+  {
+    // Decompress members one by one. Data after the last member are ignored,
+    // unless they look like another member.
+    size_t off = 0;
+    do {
+      Inflator infl(31);
+      off += infl.update(output, data.data() + off, data.size() - off);
+      infl.finish(output);
+    }
+    while((data.size() - off >= 2) && (::memcmp(data.data() + off, "\x1F\x8B", 2) == 0));
+  }
+
+bool
+do_gunzip_parallel(V_string& output, const V_string& data, size_t nthreads)
+  {
+    // Locate all members. If any of them doesn't record its size, give up.
+    cow_vector<pair<size_t, size_t>> members;
+    size_t off = 0;
+    while(off != data.size()) {
+      size_t size;
+      if(!do_gzip_member_size(size, data.data() + off, data.size() - off))
+        return false;
+
+      members.emplace_back(off, size);
+      off += size;
+    }
+
+    if(members.size() < 2)
+      return false;
+
+    cow_vector<V_string> outs;
+    outs.append(members.size());
+    V_string* pouts = outs.mut_data();
+
+    parallel_for_each(members.size(), nthreads,
+        [&](size_t k) {
+          const char* bptr = data.data() + members[k].first;
+          size_t size = members[k].second;
+
+          // Reserve space according to the uncompressed size in the trailer,
+          // which is validated by zlib, but don't trust it too much.
+          size_t isize = do_load_le32(bptr + size - 4);
+          pouts[k].reserve(::std::min(isize, size * 1032));
+
+          Inflator infl(31);
+          if(infl.update(pouts[k], bptr, size) != size)
+            ASTERIA_THROW_RUNTIME_ERROR((
+                "Invalid gzip member at offset `$1`"),
+                members[k].first);
+
+          infl.finish(pouts[k]);
+        });
+
+    size_t total = 0;
+    for(const auto& out : outs)
+      total += out.size();
+
+    output.reserve(total);
+    for(const auto& out : outs)
+      output.append(out);
+    return true;
+  }
+
 }  // namespace
 
 V_object
@@ -498,8 +1123,12 @@ std_zlib_Deflator_clear(V_opaque& r)
   }
 
 V_string
-std_zlib_deflate(V_string data, optV_integer level)
+std_zlib_deflate(V_string data, optV_integer level, optV_integer threads)
   {
+    size_t nthreads = get_thread_count(threads);
+    if((nthreads > 1) && (data.size() > 0x40000))
+      return do_deflate_parallel(data, do_wbits(sref("deflate")), do_level(level), nthreads);
+
     Deflator defl(do_wbits(sref("deflate")), do_level(level));
     V_string output;
     defl.update(output, data.data(), data.size());
@@ -508,8 +1137,12 @@ std_zlib_deflate(V_string data, optV_integer level)
   }
 
 V_string
-std_zlib_gzip(V_string data, optV_integer level)
+std_zlib_gzip(V_string data, optV_integer level, optV_integer threads)
   {
+    size_t nthreads = get_thread_count(threads);
+    if((nthreads > 1) && (data.size() > 0x40000))
+      return do_deflate_parallel(data, do_wbits(sref("gzip")), do_level(level), nthreads);
+
     Deflator defl(do_wbits(sref("gzip")), do_level(level));
     V_string output;
     defl.update(output, data.data(), data.size());
@@ -567,15 +1200,73 @@ std_zlib_inflate(V_string data)
   }
 
 V_string
-std_zlib_gunzip(V_string data)
+std_zlib_gunzip(V_string data, optV_integer threads)
   {
-    Inflator infl(do_wbits(sref("gzip")));
+    size_t nthreads = get_thread_count(threads);
     V_string output;
-    infl.update(output, data.data(), data.size());
-    infl.finish(output);
+    if((nthreads > 1) && do_gunzip_parallel(output, data, nthreads))
+      return output;
+
+    do_gunzip_sequential(output, data);
     return output;
   }
 
+V_object
+std_zlib_open_gzip_writer(V_string path, optV_integer level)
+  {
+    V_object result;
+    do_construct_Gzip_File_Writer(result, path, level);
+    return result;
+  }
+
+void
+std_zlib_GzipWriter_write(V_opaque& r, V_string data)
+  {
+    r.open<Gzip_File_Writer>().write(data.data(), data.size());
+  }
+
+void
+std_zlib_GzipWriter_flush(V_opaque& r)
+  {
+    r.open<Gzip_File_Writer>().flush();
+  }
+
+void
+std_zlib_GzipWriter_close(V_opaque& r)
+  {
+    r.open<Gzip_File_Writer>().close();
+  }
+
+V_object
+std_zlib_open_gzip_reader(V_string path)
+  {
+    V_object result;
+    do_construct_Gzip_File_Reader(result, path);
+    return result;
+  }
+
+optV_string
+std_zlib_GzipReader_read(V_opaque& r, optV_integer limit)
+  {
+    if(limit && (*limit <= 0))
+      ASTERIA_THROW_RUNTIME_ERROR((
+          "Read limit not valid (limit `$1`)"),
+          *limit);
+
+    V_string data;
+    size_t rlimit = limit ? ::rocket::clamp_cast<size_t>(*limit, 1, PTRDIFF_MAX) : SIZE_MAX;
+    if(!r.open<Gzip_File_Reader>().read(data, rlimit))
+      return nullopt;
+
+    return data;
+  }
+
+void
+std_zlib_GzipReader_close(V_opaque& r)
+  {
+    r.open<Gzip_File_Reader>().close();
+  }
+
 void
 create_bindings_zlib(V_object& result, API_Version /*version*/)
   {
@@ -598,34 +1289,38 @@ create_bindings_zlib(V_object& result, API_Version /*version*/)
 
     result.insert_or_assign(sref("deflate"),
       ASTERIA_BINDING(
-        "std.zlib.deflate", "data, [level]",
+        "std.zlib.deflate", "data, [level], [threads]",
         Argument_Reader&& reader)
       {
         V_string data;
         optV_integer level;
+        optV_integer threads;
 
         reader.start_overload();
         reader.required(data);
         reader.optional(level);
+        reader.optional(threads);
         if(reader.end_overload())
-          return (Value) std_zlib_deflate(data, level);
+          return (Value) std_zlib_deflate(data, level, threads);
 
         reader.throw_no_matching_function_call();
       });
 
     result.insert_or_assign(sref("gzip"),
       ASTERIA_BINDING(
-        "std.zlib.gzip", "data, [level]",
+        "std.zlib.gzip", "data, [level], [threads]",
         Argument_Reader&& reader)
       {
         V_string data;
         optV_integer level;
+        optV_integer threads;
 
         reader.start_overload();
         reader.required(data);
         reader.optional(level);
+        reader.optional(threads);
         if(reader.end_overload())
-          return (Value) std_zlib_gzip(data, level);
+          return (Value) std_zlib_gzip(data, level, threads);
 
         reader.throw_no_matching_function_call();
       });
@@ -662,15 +1357,49 @@ create_bindings_zlib(V_object& result, API_Version /*version*/)
 
     result.insert_or_assign(sref("gunzip"),
       ASTERIA_BINDING(
-        "std.zlib.gunzip", "data",
+        "std.zlib.gunzip", "data, [threads]",
         Argument_Reader&& reader)
       {
         V_string data;
+        optV_integer threads;
 
         reader.start_overload();
         reader.required(data);
+        reader.optional(threads);
+        if(reader.end_overload())
+          return (Value) std_zlib_gunzip(data, threads);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("open_gzip_writer"),
+      ASTERIA_BINDING(
+        "std.zlib.open_gzip_writer", "path, [level]",
+        Argument_Reader&& reader)
+      {
+        V_string path;
+        optV_integer level;
+
+        reader.start_overload();
+        reader.required(path);
+        reader.optional(level);
+        if(reader.end_overload())
+          return (Value) std_zlib_open_gzip_writer(path, level);
+
+        reader.throw_no_matching_function_call();
+      });
+
+    result.insert_or_assign(sref("open_gzip_reader"),
+      ASTERIA_BINDING(
+        "std.zlib.open_gzip_reader", "path",
+        Argument_Reader&& reader)
+      {
+        V_string path;
+
+        reader.start_overload();
+        reader.required(path);
         if(reader.end_overload())
-          return (Value) std_zlib_gunzip(data);
+          return (Value) std_zlib_open_gzip_reader(path);
 
         reader.throw_no_matching_function_call();
       });
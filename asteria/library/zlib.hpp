@@ -28,11 +28,11 @@ std_zlib_Deflator_clear(V_opaque& r);
 
 // `std.zlib.deflate`
 V_string
-std_zlib_deflate(V_string data, optV_integer level);
+std_zlib_deflate(V_string data, optV_integer level, optV_integer threads);
 
 // `std.zlib.gzip`
 V_string
-std_zlib_gzip(V_string data, optV_integer level);
+std_zlib_gzip(V_string data, optV_integer level, optV_integer threads);
 
 // `std.zlib.Inflator`
 V_object
@@ -59,7 +59,30 @@ std_zlib_inflate(V_string data);
 
 // `std.zlib.gunzip`
 V_string
-std_zlib_gunzip(V_string data);
+std_zlib_gunzip(V_string data, optV_integer threads);
+
+// `std.zlib.open_gzip_writer`
+V_object
+std_zlib_open_gzip_writer(V_string path, optV_integer level);
+
+void
+std_zlib_GzipWriter_write(V_opaque& r, V_string data);
+
+void
+std_zlib_GzipWriter_flush(V_opaque& r);
+
+void
+std_zlib_GzipWriter_close(V_opaque& r);
+
+// `std.zlib.open_gzip_reader`
+V_object
+std_zlib_open_gzip_reader(V_string path);
+
+optV_string
+std_zlib_GzipReader_read(V_opaque& r, optV_integer limit);
+
+void
+std_zlib_GzipReader_close(V_opaque& r);
 
 // Create an object that is to be referenced as `std.zlib`.
 void
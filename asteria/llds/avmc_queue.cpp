@@ -76,6 +76,11 @@ do_allocate_node_storage(Uparam uparam, size_t size)
       uint32_t size_to_reserve = this->m_used + nheaders_p1;
 #ifndef ROCKET_DEBUG
       size_to_reserve |= this->m_used * 3;
+
+      // Don't let speculative growth exceed the limit.
+      constexpr uint32_t estor_max = 0x7FFF000U / sizeof(Header) - 1;
+      if(size_to_reserve > estor_max)
+        size_to_reserve = ::std::max(estor_max, this->m_used + nheaders_p1);
 #endif
       this->do_reallocate(size_to_reserve);
     }
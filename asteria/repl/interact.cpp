@@ -140,7 +140,7 @@ read_execute_print_single()
       }
 
       ::rocket::tinybuf_str cbuf(repl_source, tinybuf::open_read);
-      tstrm.reload(real_name, 1, ::std::move(cbuf));
+      tstrm.reload(real_name, 1, cbuf);
       stmtq.reload(::std::move(tstrm));
 
       repl_script.reload(real_name, ::std::move(stmtq));
@@ -161,7 +161,7 @@ read_execute_print_single()
         }
 
         ::rocket::tinybuf_str cbuf(repl_source, tinybuf::open_read);
-        tstrm.reload(real_name, 1, ::std::move(cbuf));
+        tstrm.reload(real_name, 1, cbuf);
         stmtq.reload_oneline(::std::move(tstrm));
 
         repl_script.reload(real_name, ::std::move(stmtq));
@@ -23,6 +23,9 @@ Usage: %s [OPTIONS] [[--] FILE [ARGUMENTS]...]
   -h      show help message then exit
   -I      suppress interactive mode [default = auto]
   -i      force interactive mode [default = auto]
+  -j      equivalent to `-j0`
+  -j[nn]  compile on `nn` threads, or all processors if `nn` is zero
+          [default = 1]
   -O      equivalent to `-O1`
   -O[nn]  set optimization level to `nn` [default = 2]
   -V      show version information then exit
@@ -90,6 +93,7 @@ do_parse_command_line(int argc, char** argv)
     opt<bool> verbose;
     opt<bool> interactive;
     opt<long> optimize;
+    opt<long> threads;
 
     opt<cow_string> path;
     cow_vector<Value> args;
@@ -105,7 +109,7 @@ do_parse_command_line(int argc, char** argv)
 
     // Parse command-line options.
     int ch;
-    while((ch = ::getopt(argc, argv, "+hIiO::Vv")) != -1) {
+    while((ch = ::getopt(argc, argv, "+hIij::O::Vv")) != -1) {
       // Identify a single option.
       switch(ch) {
         case 'h':
@@ -120,6 +124,22 @@ do_parse_command_line(int argc, char** argv)
           interactive = true;
           continue;
 
+        case 'j': {
+          // If `-j` is specified without an argument, it is equivalent to `-j0`.
+          threads = 0;
+          if(!optarg || !*optarg)
+            continue;
+
+          char* ep;
+          long val = ::strtol(optarg, &ep, 10);
+          if((*ep != 0) || (val < 0) || (val > UINT8_MAX))
+            exit_printf(exit_invalid_argument,
+                  "%s: invalid number of threads -- '%s'\n", argv[0], optarg);
+
+          threads = val;
+          continue;
+        }
+
         case 'O': {
           // If `-O` is specified without an argument, it is equivalent to `-O1`.
           optimize = 1;
@@ -185,6 +205,10 @@ do_parse_command_line(int argc, char** argv)
     if(optimize)
       repl_script.options().optimization_level = uint8_t(*optimize);
 
+    // Code is generated on the calling thread by default.
+    if(threads)
+      repl_script.options().compilation_threads = uint8_t(*threads);
+
     // These arguments are always overwritten.
     repl_file = path.move_value_or(sref("-"));
     repl_args = ::std::move(args);
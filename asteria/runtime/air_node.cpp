@@ -807,28 +807,14 @@ struct Traits_try_statement
         // This branch must be executed inside this `catch` block.
         // User-provided bindings may obtain the current exception using
         // `::std::current_exception`.
-        Executive_Context ctx_catch(Executive_Context::M_plain(), ctx);
+        // Backtrace frames are converted only if `__backtrace` is mentioned.
+        Executive_Context ctx_catch(Executive_Context::M_plain(), ctx, except);
         AIR_Status status;
         try {
           // Set the exception reference.
           ctx_catch.insert_named_reference(sp.name_except)
               .set_temporary(except.value());
 
-          // Set backtrace frames.
-          V_array backtrace;
-          for(size_t k = 0;  k < except.count_frames();  ++k) {
-            V_object r;
-            r.try_emplace(sref("frame"), sref(except.frame(k).what_type()));
-            r.try_emplace(sref("file"), except.frame(k).file());
-            r.try_emplace(sref("line"), except.frame(k).line());
-            r.try_emplace(sref("column"), except.frame(k).column());
-            r.try_emplace(sref("value"), except.frame(k).value());
-            backtrace.emplace_back(::std::move(r));
-          }
-
-          ctx_catch.insert_named_reference(sref("__backtrace"))
-              .set_temporary(::std::move(backtrace));
-
           // Execute the `catch` clause.
           status = sp.queue_catch.execute(ctx_catch);
         }
@@ -1149,6 +1135,7 @@ struct Traits_coalescence
       }
   };
 
+template<PTC_Aware ptcT>
 struct Traits_function_call
   {
     static
@@ -1164,8 +1151,7 @@ struct Traits_function_call
       {
         AVMC_Queue::Uparam up;
         up.u32 = altr.nargs;
-        up.u8v[0] = static_cast<uint8_t>(altr.ptc);
-        reachable &= (altr.ptc == ptc_aware_none);
+        reachable &= (ptcT == ptc_aware_none);
         return up;
       }
 
@@ -1197,14 +1183,13 @@ struct Traits_function_call
 
         const auto& target = value.as_function();
         auto& self = stack.mut_top().pop_modifier();
-        const auto ptc = static_cast<PTC_Aware>(up.u8v[0]);
 
         stack.clear_cache();
         alt_stack.clear_cache();
 
-        return ROCKET_EXPECT(ptc == ptc_aware_none)
+        return (ptcT == ptc_aware_none)
                  ? do_invoke_nontail(self, sloc, target, ctx.global(), ::std::move(alt_stack))
-                 : do_invoke_tail(self, sloc, target, ptc, ::std::move(alt_stack));
+                 : do_invoke_tail(self, sloc, target, ptcT, ::std::move(alt_stack));
       }
   };
 
@@ -3837,6 +3822,7 @@ struct Traits_single_step_trap
       }
   };
 
+template<PTC_Aware ptcT>
 struct Traits_variadic_call
   {
     static
@@ -3846,15 +3832,6 @@ struct Traits_variadic_call
         return altr.sloc;
       }
 
-    static
-    AVMC_Queue::Uparam
-    make_uparam(bool& /*reachable*/, const AIR_Node::S_variadic_call& altr)
-      {
-        AVMC_Queue::Uparam up;
-        up.u8v[0] = static_cast<uint8_t>(altr.ptc);
-        return up;
-      }
-
     static
     Source_Location
     make_sparam(bool& /*reachable*/, const AIR_Node::S_variadic_call& altr)
@@ -3864,7 +3841,7 @@ struct Traits_variadic_call
 
     static
     AIR_Status
-    execute(Executive_Context& ctx, AVMC_Queue::Uparam up, const Source_Location& sloc)
+    execute(Executive_Context& ctx, const Source_Location& sloc)
       {
         const auto sentry = ctx.global().copy_recursion_sentry();
         ASTERIA_CALL_GLOBAL_HOOK(ctx.global(), on_single_step_trap, sloc);
@@ -3954,14 +3931,13 @@ struct Traits_variadic_call
 
         const auto& target = value.as_function();
         auto& self = ctx.stack().mut_top().pop_modifier();
-        const auto ptc = static_cast<PTC_Aware>(up.u8v[0]);
 
         stack.clear_cache();
         alt_stack.clear_cache();
 
-        return ROCKET_EXPECT(ptc == ptc_aware_none)
+        return (ptcT == ptc_aware_none)
                  ? do_invoke_nontail(self, sloc, target, ctx.global(), ::std::move(alt_stack))
-                 : do_invoke_tail(self, sloc, target, ptc, ::std::move(alt_stack));
+                 : do_invoke_tail(self, sloc, target, ptcT, ::std::move(alt_stack));
       }
   };
 
@@ -4069,24 +4045,16 @@ struct Traits_import_call
               path);
 
         // Compile the script file into a function object.
+        auto loader = ctx.global().module_loader();
         Module_Loader::Unique_Stream utext;
         path.assign(abspath);
-        utext.reset(ctx.global().module_loader(), path.safe_c_str());
-
-        // Parse source code.
-        Token_Stream tstrm(sp.opts);
-        tstrm.reload(path, 1, ::std::move(utext.get()));
-
-        Statement_Sequence stmtq(sp.opts);
-        stmtq.reload(::std::move(tstrm));
+        utext.reset(loader, path.safe_c_str());
 
-        // Instantiate the function.
-        const Source_Location sloc(path, 0, 0);
-        const cow_vector<phsh_string> params(1, sref("..."));
-
-        AIR_Optimizer optmz(sp.opts);
-        optmz.reload(nullptr, params, ctx.global(), stmtq);
-        auto qtarget = optmz.create_function(sloc, sref("[file scope]"));
+        // Reuse the function if the file has been compiled and not modified
+        // since then. The stream is still locked, so recursion is detected.
+        auto qtarget = loader->get_cached_function_opt(utext, path, sp.opts);
+        if(!qtarget)
+          qtarget = loader->compile_stream(utext, path, sp.opts, ctx.global());
 
         stack.clear_cache();
         alt_stack.clear_cache();
@@ -4748,6 +4716,32 @@ do_solidify(AVMC_Queue& queue, const NodeT& altr)
     return reachable;
   }
 
+template<template<PTC_Aware> class TraitsT, typename NodeT>
+inline
+bool
+do_solidify_ptc(AVMC_Queue& queue, const NodeT& altr)
+  {
+    // Select a specialization, so the PTC mode is not checked at run time.
+    switch(altr.ptc) {
+      case ptc_aware_none:
+        return do_solidify<TraitsT<ptc_aware_none>>(queue, altr);
+
+      case ptc_aware_by_ref:
+        return do_solidify<TraitsT<ptc_aware_by_ref>>(queue, altr);
+
+      case ptc_aware_by_val:
+        return do_solidify<TraitsT<ptc_aware_by_val>>(queue, altr);
+
+      case ptc_aware_void:
+        return do_solidify<TraitsT<ptc_aware_void>>(queue, altr);
+
+      default:
+        ASTERIA_TERMINATE((
+            "Invalid PTC awareness (ptc `$1`)"),
+            altr.ptc);
+    }
+  }
+
 }  // namespace
 
 opt<AIR_Node>
@@ -5092,7 +5086,7 @@ solidify(AVMC_Queue& queue) const
                        this->m_stor.as<index_coalescence>());
 
       case index_function_call:
-        return do_solidify<Traits_function_call>(queue,
+        return do_solidify_ptc<Traits_function_call>(queue,
                        this->m_stor.as<index_function_call>());
 
       case index_member_access:
@@ -5305,7 +5299,7 @@ solidify(AVMC_Queue& queue) const
                        this->m_stor.as<index_single_step_trap>());
 
       case index_variadic_call:
-        return do_solidify<Traits_variadic_call>(queue,
+        return do_solidify_ptc<Traits_variadic_call>(queue,
                        this->m_stor.as<index_variadic_call>());
 
       case index_defer_expression:
@@ -16,6 +16,124 @@ AIR_Optimizer::
   {
   }
 
+void
+AIR_Optimizer::
+do_reload_parallel(Analytic_Context& ctx_func, size_t nthreads, const Global_Context& global,
+                   const cow_vector<Statement>& stmts)
+  {
+    // Generate code for all statements except bodies of functions, which are
+    // left empty. Names that are declared by each statement are recorded, so
+    // a function body can be generated with exactly the names that would have
+    // been visible when it was generated sequentially.
+    struct Deferred
+      {
+        size_t stmt_index;
+        size_t node_index;
+        cow_vector<AIR_Node> code_body;
+        ::std::exception_ptr except;
+      };
+
+    cow_vector<cow_vector<phsh_string>> decls;
+    cow_vector<Deferred> funcs;
+    ::std::exception_ptr except;
+    size_t except_index = stmts.size();
+
+    for(size_t k = 0;  k < stmts.size();  ++k) {
+      auto& names = decls.emplace_back();
+      auto qfunc = stmts.at(k).function_opt();
+      if(qfunc) {
+        // Declare the function, which is effectively an immutable variable.
+        // Its body will be generated later.
+        if(!qfunc->name.empty()) {
+          ctx_func.insert_named_reference(qfunc->name);
+          names.emplace_back(qfunc->name);
+        }
+
+        AIR_Node::S_declare_variable xnode_decl = { qfunc->sloc, qfunc->name };
+        this->m_code.emplace_back(::std::move(xnode_decl));
+
+        funcs.push_back({ k, this->m_code.size(), { }, nullptr });
+        AIR_Node::S_define_function xnode_defn = { this->m_opts, qfunc->sloc, qfunc->name,
+                                                   qfunc->params, { } };
+        this->m_code.emplace_back(::std::move(xnode_defn));
+
+        AIR_Node::S_initialize_variable xnode_init = { qfunc->sloc, true };
+        this->m_code.emplace_back(::std::move(xnode_init));
+        continue;
+      }
+
+      try {
+        bool last = (k + 1 == stmts.size()) || stmts.at(k + 1).is_empty_return();
+        stmts.at(k).generate_code(this->m_code, &names, global, ctx_func, this->m_opts,
+                                  last ? ptc_aware_void : ptc_aware_none);
+      }
+      catch(...) {
+        // Functions before this statement shall still be generated, as
+        // errors in them take precedence.
+        except = ::std::current_exception();
+        except_index = k;
+        break;
+      }
+
+      // Names of nested scopes, such as those of for-each statements, are
+      // also collected, so only keep those that are visible now.
+      for(size_t i = names.size() - 1;  i != SIZE_MAX;  --i)
+        if(!ctx_func.get_named_reference_opt(names[i]))
+          names.erase(i, 1);
+    }
+
+    // Split functions into contiguous ranges. Each thread replays declarations
+    // in its own context, in source order.
+    size_t nchunks = ::std::min(nthreads, funcs.size());
+    parallel_for_each(nchunks, nchunks,
+      [&](size_t chunk) {
+        size_t fbegin = funcs.size() * chunk / nchunks;
+        size_t fend = funcs.size() * (chunk + 1) / nchunks;
+
+        Analytic_Context ctx_chunk(Analytic_Context::M_function(), nullptr, this->m_params);
+        size_t next_stmt = 0;
+
+        for(size_t i = fbegin;  i != fend;  ++i) {
+          auto& func = funcs.mut(i);
+          while(next_stmt <= func.stmt_index) {
+            for(const auto& name : decls.at(next_stmt))
+              ctx_chunk.insert_named_reference(name);
+            next_stmt ++;
+          }
+
+          try {
+            const auto& altr = *(stmts.at(func.stmt_index).function_opt());
+            AIR_Optimizer optmz(this->m_opts);
+            optmz.reload(&ctx_chunk, altr.params, global, altr.body);
+            func.code_body = optmz.get_code();
+          }
+          catch(...) {
+            // Stop at the first error in this range.
+            func.except = ::std::current_exception();
+            break;
+          }
+        }
+      });
+
+    // Rethrow the error that would have occurred first.
+    for(const auto& func : funcs)
+      if(func.except && (func.stmt_index < except_index)) {
+        except = func.except;
+        break;
+      }
+
+    if(except)
+      ::std::rethrow_exception(except);
+
+    // Stitch function bodies into the code.
+    for(auto& func : funcs) {
+      const auto& altr = *(stmts.at(func.stmt_index).function_opt());
+      AIR_Node::S_define_function xnode = { this->m_opts, altr.sloc, altr.name, altr.params,
+                                            ::std::move(func.code_body) };
+      this->m_code.mut(func.node_index) = ::std::move(xnode);
+    }
+  }
+
 void
 AIR_Optimizer::
 reload(Abstract_Context* ctx_opt, const cow_vector<phsh_string>& params,
@@ -30,13 +148,24 @@ reload(Abstract_Context* ctx_opt, const cow_vector<phsh_string>& params,
     // Create a context of the function body.
     Analytic_Context ctx_func(Analytic_Context::M_function(), ctx_opt, this->m_params);
 
-    // Generate code for all statements.
-    for(size_t k = 0;  k + 1 < stmts.size();  ++k)
-      stmts.at(k).generate_code(this->m_code, nullptr, global, ctx_func, this->m_opts,
-              stmts.at(k + 1).is_empty_return() ? ptc_aware_void : ptc_aware_none);
-
-    stmts.back().generate_code(this->m_code, nullptr, global, ctx_func, this->m_opts,
-            ptc_aware_void);
+    // Bodies of top-level functions may be generated in parallel. Nested
+    // functions are always generated on the thread of their parent.
+    size_t nthreads = 1;
+    if(!ctx_opt)
+      nthreads = this->m_opts.compilation_threads ? this->m_opts.compilation_threads
+                                                  : get_processor_count();
+
+    if(nthreads > 1)
+      do_reload_parallel(ctx_func, nthreads, global, stmts);
+    else {
+      // Generate code for all statements.
+      for(size_t k = 0;  k + 1 < stmts.size();  ++k)
+        stmts.at(k).generate_code(this->m_code, nullptr, global, ctx_func, this->m_opts,
+                stmts.at(k + 1).is_empty_return() ? ptc_aware_void : ptc_aware_none);
+
+      stmts.back().generate_code(this->m_code, nullptr, global, ctx_func, this->m_opts,
+              ptc_aware_void);
+    }
 
     // Check whether optimization is enabled during translation.
     if(this->m_opts.optimization_level < 2)
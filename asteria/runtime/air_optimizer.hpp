@@ -23,6 +23,11 @@ class AIR_Optimizer
       {
       }
 
+  private:
+    void
+    do_reload_parallel(Analytic_Context& ctx_func, size_t nthreads, const Global_Context& global,
+                       const cow_vector<Statement>& stmts);
+
   public:
     ASTERIA_COPYABLE_DESTRUCTOR(AIR_Optimizer);
 
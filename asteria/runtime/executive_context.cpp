@@ -67,6 +67,14 @@ Executive_Context(M_function, Global_Context& global, Reference_Stack& stack,
       this->m_lazy_args.emplace_back(::std::move(stack.mut_top(-- arg_counter)));
   }
 
+Executive_Context::
+Executive_Context(M_plain, Executive_Context& parent, const Runtime_Error& except)
+  :
+    m_parent_opt(&parent), m_global(parent.m_global), m_stack(parent.m_stack),
+    m_alt_stack(parent.m_alt_stack), m_backtrace(except.frames())
+  {
+  }
+
 Executive_Context::
 ~Executive_Context()
   {
@@ -110,6 +118,26 @@ do_create_lazy_reference_opt(Reference* hint_opt, phsh_stringR name) const
       return &ref;
     }
 
+    if((name == sref("__backtrace")) && !this->m_backtrace.empty()) {
+      auto& ref = this->do_mut_named_reference(hint_opt, name);
+
+      // Convert frames to objects. This is expensive, and can only happen
+      // inside a `catch` clause which mentions `__backtrace`.
+      V_array backtrace;
+      for(const auto& frm : this->m_backtrace) {
+        V_object r;
+        r.try_emplace(sref("frame"), sref(frm.what_type()));
+        r.try_emplace(sref("file"), frm.file());
+        r.try_emplace(sref("line"), frm.line());
+        r.try_emplace(sref("column"), frm.column());
+        r.try_emplace(sref("value"), frm.value());
+        backtrace.emplace_back(::std::move(r));
+      }
+
+      ref.set_temporary(::std::move(backtrace));
+      return &ref;
+    }
+
     return nullptr;
   }
 
@@ -7,6 +7,7 @@
 #include "../fwd.hpp"
 #include "abstract_context.hpp"
 #include "variadic_arguer.hpp"
+#include "backtrace_frame.hpp"
 namespace asteria {
 
 class Executive_Context
@@ -25,6 +26,7 @@ class Executive_Context
     cow_bivector<Source_Location, AVMC_Queue> m_defer;
     refcnt_ptr<Variadic_Arguer> m_zvarg;
     cow_vector<Reference> m_lazy_args;
+    cow_vector<Backtrace_Frame> m_backtrace;  // for `catch` clauses
 
   public:
     // A plain context must have a parent context.
@@ -37,6 +39,11 @@ class Executive_Context
       {
       }
 
+    // This is a plain context for a `catch` clause. The backtrace of the
+    // exception is copied, and `__backtrace` is created when it is mentioned.
+    explicit
+    Executive_Context(M_plain, Executive_Context& parent, const Runtime_Error& except);
+
     // A defer context is used to evaluate deferred expressions.
     // They are evaluated in separated contexts, as in case of proper tail calls,
     // contexts of enclosing function will have been destroyed.
@@ -6,6 +6,7 @@
 #include "garbage_collector.hpp"
 #include "random_engine.hpp"
 #include "module_loader.hpp"
+#include "regex_cache.hpp"
 #include "variable.hpp"
 #include "abstract_hooks.hpp"
 #include "../library/version.hpp"
@@ -24,6 +25,7 @@
 #include "../library/ini.hpp"
 #include "../library/csv.hpp"
 #include "../utils.hpp"
+#include "../../rocket/mutex.hpp"
 namespace asteria {
 namespace {
 
@@ -71,6 +73,46 @@ struct Module_Comparator
       { return lhs.version < rhs;  }
   };
 
+// The `std` object is built once for each set of modules, and is shared by
+// all global contexts in this process. As objects are copy-on-write, and the
+// `std` variable is immutable, a context never modifies the shared object.
+// Bindings are stateless, so sharing them across threads is safe.
+class Std_Cache
+  {
+  private:
+    ::rocket::mutex m_mutex;
+    opt<V_object> m_objs[sizeof(s_modules) / sizeof(*s_modules)];
+
+  public:
+    V_object
+    get(const Module* eptr)
+      {
+        ::rocket::mutex::unique_lock lock(this->m_mutex);
+        auto& ostd = this->m_objs[eptr - begin(s_modules) - 1];
+        if(ROCKET_EXPECT(ostd))
+          return *ostd;
+
+        V_object temp;
+        ::std::for_each(begin(s_modules), eptr,
+          [&](const Module& mod) {
+            auto r = temp.try_emplace(sref(mod.name));
+            if(r.second)
+              r.first->second = V_object();
+            mod.init(r.first->second.mut_object(), eptr[-1].version);
+          });
+
+        ostd.emplace(::std::move(temp));
+        return *ostd;
+      }
+  };
+
+Std_Cache&
+do_get_std_cache()
+  {
+    static Std_Cache s_cache;
+    return s_cache;
+  }
+
 }  // namespace
 
 Global_Context::
@@ -78,7 +120,8 @@ Global_Context(API_Version version)
   :
     m_gcoll(::rocket::make_refcnt<Garbage_Collector>()),
     m_prng(::rocket::make_refcnt<Random_Engine>()),
-    m_ldrlk(::rocket::make_refcnt<Module_Loader>())
+    m_ldrlk(::rocket::make_refcnt<Module_Loader>()),
+    m_regex(::rocket::make_refcnt<Regex_Cache>())
   {
     // Get the range of modules to initialize.
     // This also determines the maximum version number of the library, which
@@ -90,14 +133,8 @@ Global_Context(API_Version version)
     auto bptr = begin(s_modules);
     auto eptr = ::std::upper_bound(bptr, end(s_modules), version, comp);
 
-    V_object ostd;
-    ::std::for_each(bptr, eptr,
-      [&](const Module& mod) {
-        auto r = ostd.try_emplace(sref(mod.name));
-        if(r.second)
-          r.first->second = V_object();
-        mod.init(r.first->second.mut_object(), eptr[-1].version);
-      });
+    ROCKET_ASSERT(eptr != bptr);
+    auto ostd = do_get_std_cache().get(eptr);
 
     // Allocate the global variable `std`.
     const auto gcoll = unerase_pointer_cast<Garbage_Collector>(this->m_gcoll);
@@ -20,6 +20,7 @@ class Global_Context
     rcfwd_ptr<Garbage_Collector> m_gcoll;
     rcfwd_ptr<Random_Engine> m_prng;
     rcfwd_ptr<Module_Loader> m_ldrlk;
+    rcfwd_ptr<Regex_Cache> m_regex;
     rcfwd_ptr<Variable> m_vstd;
 
   public:
@@ -83,6 +84,11 @@ class Global_Context
     module_loader() const noexcept
       { return unerase_pointer_cast<Module_Loader>(this->m_ldrlk);  }
 
+    ASTERIA_INCOMPLET(Regex_Cache)
+    refcnt_ptr<Regex_Cache>
+    regex_cache() const noexcept
+      { return unerase_pointer_cast<Regex_Cache>(this->m_regex);  }
+
     ASTERIA_INCOMPLET(Variable)
     refcnt_ptr<Variable>
     std_variable() const noexcept
@@ -12,6 +12,21 @@
 #include "../llds/reference_stack.hpp"
 #include "../utils.hpp"
 namespace asteria {
+namespace {
+
+atomic_relaxed<int64_t> s_count_instantiated;
+atomic_relaxed<int64_t> s_count_solidified;
+
+}  // namespace
+
+Instantiated_Function::
+Instantiated_Function(const cow_vector<phsh_string>& params, refcnt_ptr<Variadic_Arguer>&& zvarg,
+                      const cow_vector<AIR_Node>& code)
+  :
+    m_params(params), m_zvarg(::std::move(zvarg)), m_code(code)
+  {
+    s_count_instantiated.xadd(1);
+  }
 
 Instantiated_Function::
 ~Instantiated_Function()
@@ -20,11 +35,30 @@ Instantiated_Function::
 
 void
 Instantiated_Function::
-do_solidify(const cow_vector<AIR_Node>& code)
+do_solidify() const
   {
+    // If an exception is thrown, the function remains unsolidified.
     this->m_queue.clear();
-    ::rocket::all_of(code, [&](const AIR_Node& node) { return node.solidify(this->m_queue);  });
+    ::rocket::all_of(this->m_code, [&](const AIR_Node& node) { return node.solidify(this->m_queue);  });
     this->m_queue.finalize();
+
+    this->m_code.clear();
+    this->m_solidified = true;
+    s_count_solidified.xadd(1);
+  }
+
+int64_t
+Instantiated_Function::
+count_instantiated() noexcept
+  {
+    return s_count_instantiated.load();
+  }
+
+int64_t
+Instantiated_Function::
+count_solidified() noexcept
+  {
+    return s_count_solidified.load();
   }
 
 tinyfmt&
@@ -38,13 +72,20 @@ void
 Instantiated_Function::
 collect_variables(Variable_HashMap& staged, Variable_HashMap& temp) const
   {
-    this->m_queue.collect_variables(staged, temp);
+    if(this->m_solidified)
+      this->m_queue.collect_variables(staged, temp);
+    else
+      for(const auto& node : this->m_code)
+        node.collect_variables(staged, temp);
   }
 
 Reference&
 Instantiated_Function::
 invoke_ptc_aware(Reference& self, Global_Context& global, Reference_Stack&& stack) const
   {
+    if(ROCKET_UNEXPECT(!this->m_solidified))
+      this->do_solidify();
+
     // Create the stack and context for this function.
     Reference_Stack alt_stack;
     Executive_Context ctx_func(Executive_Context::M_function(), global, stack, alt_stack,
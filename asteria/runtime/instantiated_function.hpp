@@ -16,23 +16,35 @@ class Instantiated_Function final
   private:
     cow_vector<phsh_string> m_params;
     refcnt_ptr<Variadic_Arguer> m_zvarg;
-    AVMC_Queue m_queue;
+
+    // The body is solidified when the function is called for the first time.
+    // After that, `m_code` is cleared.
+    mutable cow_vector<AIR_Node> m_code;
+    mutable AVMC_Queue m_queue;
+    mutable bool m_solidified = false;
 
   public:
     explicit
     Instantiated_Function(const cow_vector<phsh_string>& params, refcnt_ptr<Variadic_Arguer>&& zvarg,
-                          const cow_vector<AIR_Node>& code)
-      :
-        m_params(params), m_zvarg(::std::move(zvarg))
-      { this->do_solidify(code);  }
+                          const cow_vector<AIR_Node>& code);
 
   private:
     void
-    do_solidify(const cow_vector<AIR_Node>& code);
+    do_solidify() const;
 
   public:
     ASTERIA_NONCOPYABLE_DESTRUCTOR(Instantiated_Function);
 
+    // These are process-wide counters of functions that have been created,
+    // and of those whose bodies have been solidified.
+    static
+    int64_t
+    count_instantiated() noexcept;
+
+    static
+    int64_t
+    count_solidified() noexcept;
+
     tinyfmt&
     describe(tinyfmt& fmt) const override;
 
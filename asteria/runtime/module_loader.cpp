@@ -4,11 +4,31 @@
 #include "../precompiled.ipp"
 #include "module_loader.hpp"
 #include "runtime_error.hpp"
+#include "global_context.hpp"
+#include "air_optimizer.hpp"
+#include "../compiler/token_stream.hpp"
+#include "../compiler/statement_sequence.hpp"
 #include "../utils.hpp"
 #include <sys/stat.h>
 #include <sys/file.h>  // ::flock()
 #include <unistd.h>  // ::fstat()
 namespace asteria {
+namespace {
+
+int64_t
+do_mtime_ns(const struct ::stat& info) noexcept
+  {
+    return info.st_mtim.tv_sec * 1000000000LL + info.st_mtim.tv_nsec;
+  }
+
+bool
+do_stat_stream(struct ::stat& info, const ::rocket::tinybuf_file& file) noexcept
+  {
+    auto fp = file.get_handle();
+    return fp && (::fstat(::fileno(fp), &info) == 0);
+  }
+
+}  // namespace
 
 Module_Loader::
 ~Module_Loader()
@@ -66,4 +86,143 @@ do_unlock_stream(locked_stream_pair* qstrm) noexcept
     ROCKET_ASSERT(count == 1);
   }
 
+bool
+Module_Loader::
+invalidate(const char* path) noexcept
+  {
+    struct ::stat info;
+    if(::stat(path, &info) != 0)
+      return false;
+
+    auto skey = format_string("dev:$1/ino:$2", info.st_dev, info.st_ino);
+    return this->m_cache.erase(skey) != 0;
+  }
+
+cow_function
+Module_Loader::
+get_cached_function_opt(const Unique_Stream& strm, const cow_string& path,
+                        const Compiler_Options& opts) const
+  {
+    ROCKET_ASSERT(strm.m_strm);
+    auto qmod = this->m_cache.ptr(strm.m_strm->first);
+    if(!qmod)
+      return nullptr;
+
+    // Check whether the file has been modified since it was compiled.
+    struct ::stat info;
+    if(!do_stat_stream(info, strm.m_strm->second))
+      return nullptr;
+
+    if((qmod->mtime_ns != do_mtime_ns(info)) || (qmod->size != info.st_size))
+      return nullptr;
+
+    if((qmod->path != path) || (::memcmp(&(qmod->opts), &opts, sizeof(opts)) != 0))
+      return nullptr;
+
+    return qmod->func;
+  }
+
+void
+Module_Loader::
+set_cached_function(const Unique_Stream& strm, const cow_string& path,
+                    const Compiler_Options& opts, int64_t mtime_ns,
+                    int64_t size, const cow_function& func)
+  {
+    ROCKET_ASSERT(strm.m_strm);
+    if(!this->m_cache_enabled)
+      return;
+
+    // If the file has been replaced, it will have a new ID, and the old entry
+    // will never be hit again.
+    // Erasing elements may move others around, so collect keys first.
+    cow_vector<phsh_string> stale;
+    for(const auto& r : this->m_cache)
+      if(r.second.path == path)
+        stale.emplace_back(r.first);
+
+    for(const auto& key : stale)
+      this->m_cache.erase(key);
+
+    Cached_Module mod;
+    mod.path = path;
+    mod.mtime_ns = mtime_ns;
+    mod.size = size;
+    mod.opts = opts;
+    mod.func = func;
+    this->m_cache.insert_or_assign(strm.m_strm->first, ::std::move(mod));
+  }
+
+cow_function
+Module_Loader::
+compile_stream(const Unique_Stream& strm, const cow_string& path,
+               const Compiler_Options& opts, Global_Context& global)
+  {
+    ROCKET_ASSERT(strm.m_strm);
+
+    // Take a snapshot of the file before it is read. If it is modified while
+    // being parsed, the cached function will be out of date.
+    struct ::stat info;
+    bool cacheable = do_stat_stream(info, strm.m_strm->second);
+
+    // Parse source code.
+    Token_Stream tstrm(opts);
+    tstrm.reload(path, 1, strm.m_strm->second);
+
+    Statement_Sequence stmtq(opts);
+    stmtq.reload(::std::move(tstrm));
+
+    // Instantiate the function.
+    const Source_Location sloc(path, 0, 0);
+    const cow_vector<phsh_string> params(1, sref("..."));
+
+    AIR_Optimizer optmz(opts);
+    optmz.reload(nullptr, params, global, stmtq);
+    auto func = optmz.create_function(sloc, sref("[file scope]"));
+    if(cacheable)
+      this->set_cached_function(strm, path, opts, do_mtime_ns(info), info.st_size, func);
+    return func;
+  }
+
+cow_vector<Module_Loader::Refresh_Result>
+Module_Loader::
+refresh_cache(Global_Context& global)
+  {
+    const auto loader = global.module_loader();
+    ROCKET_ASSERT(loader == this);
+
+    // Compilation updates the cache, so make a copy first.
+    const auto cache = this->m_cache;
+    cow_vector<Refresh_Result> results;
+
+    for(const auto& r : cache) {
+      const auto& mod = r.second;
+
+      // Discard modules whose files have gone.
+      Unique_Stream strm;
+      try {
+        strm.reset(loader, mod.path.safe_c_str());
+      }
+      catch(Runtime_Error&) {
+        this->m_cache.erase(r.first);
+        continue;
+      }
+
+      // If the file has been replaced, it will have a new ID, and the old
+      // entry will be erased after it is recompiled.
+      auto& res = results.emplace_back();
+      res.path = mod.path;
+      res.recompiled = false;
+      res.compile_seconds = 0;
+
+      if(this->get_cached_function_opt(strm, mod.path, mod.opts))
+        continue;
+
+      double t0 = get_monotonic_seconds();
+      this->compile_stream(strm, mod.path, mod.opts, global);
+      res.recompiled = true;
+      res.compile_seconds = get_monotonic_seconds() - t0;
+    }
+    return results;
+  }
+
 }  // namespace asteria
@@ -15,10 +15,33 @@ class Module_Loader final
   public:
     class Unique_Stream;  // RAII wrapper
 
+    // This describes a file that has been checked for modification.
+    struct Refresh_Result
+      {
+        cow_string path;
+        bool recompiled;
+        double compile_seconds;  // zero if not recompiled
+      };
+
   private:
     cow_dictionary<::rocket::tinybuf_file> m_strms;
     using locked_stream_pair = decltype(m_strms)::value_type;
 
+    // Compiled modules are cached by file ID. A cached function is reused
+    // only if the file has not been modified since it was compiled, and the
+    // same compiler options are requested.
+    struct Cached_Module
+      {
+        cow_string path;
+        int64_t mtime_ns;
+        int64_t size;
+        Compiler_Options opts;
+        cow_function func;
+      };
+
+    cow_dictionary<Cached_Module> m_cache;
+    bool m_cache_enabled = true;
+
   public:
     explicit
     Module_Loader() noexcept
@@ -34,10 +57,68 @@ class Module_Loader final
 
   public:
     ASTERIA_NONCOPYABLE_DESTRUCTOR(Module_Loader);
+
+    // The module cache is enabled by default. Disabling it also discards
+    // all cached functions.
+    bool
+    cache_enabled() const noexcept
+      { return this->m_cache_enabled;  }
+
+    void
+    set_cache_enabled(bool enabled) noexcept
+      {
+        this->m_cache_enabled = enabled;
+        if(!enabled)
+          this->m_cache.clear();
+      }
+
+    size_t
+    cache_size() const noexcept
+      { return this->m_cache.size();  }
+
+    void
+    clear_cache() noexcept
+      { this->m_cache.clear();  }
+
+    // Discards the cached function for a file, so it will be compiled again
+    // when it is imported next time. Returns whether anything was discarded.
+    bool
+    invalidate(const char* path) noexcept;
+
+    // Gets the cached function for a locked stream, or null if none is
+    // available or it is out of date.
+    cow_function
+    get_cached_function_opt(const Unique_Stream& strm, const cow_string& path,
+                            const Compiler_Options& opts) const;
+
+    // Stores a function that has been compiled from a locked stream. This must
+    // be called before the stream is unlocked. `mtime_ns` and `size` shall be
+    // taken before the stream is read, so a modification during compilation
+    // is detected next time.
+    void
+    set_cached_function(const Unique_Stream& strm, const cow_string& path,
+                        const Compiler_Options& opts, int64_t mtime_ns,
+                        int64_t size, const cow_function& func);
+
+    // Compiles a locked stream into a function that takes variadic arguments.
+    // If the cache is enabled, the function is stored for later imports.
+    cow_function
+    compile_stream(const Unique_Stream& strm, const cow_string& path,
+                   const Compiler_Options& opts, Global_Context& global);
+
+    // Recompiles cached modules whose files have been modified, so they are
+    // ready when they are imported next time. Unchanged modules are kept, and
+    // modules whose files have gone are discarded. `global` shall own this
+    // loader. If an exception is thrown, some modules may have been
+    // recompiled.
+    cow_vector<Refresh_Result>
+    refresh_cache(Global_Context& global);
   };
 
 class Module_Loader::Unique_Stream
   {
+    friend class Module_Loader;
+
   private:
     refcnt_ptr<Module_Loader> m_loader;
     locked_stream_pair* m_strm = nullptr;
@@ -0,0 +1,83 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "../precompiled.ipp"
+#include "regex_cache.hpp"
+#include "../utils.hpp"
+namespace asteria {
+
+Regex_Cache::
+~Regex_Cache()
+  {
+  }
+
+void
+Regex_Cache::
+do_evict_lru()
+  {
+    // The capacity is expected to be small, so a linear search is fine.
+    auto qlru = this->m_entries.begin();
+    if(qlru == this->m_entries.end())
+      return;
+
+    for(auto it = qlru;  it != this->m_entries.end();  ++it)
+      if(it->second.stamp < qlru->second.stamp)
+        qlru = it;
+
+    this->m_entries.erase(qlru);
+  }
+
+Regex_Cache&
+Regex_Cache::
+set_capacity(size_t cap)
+  {
+    this->m_capacity = cap;
+    while(this->m_entries.size() > cap)
+      this->do_evict_lru();
+    return *this;
+  }
+
+refcnt_ptr<Abstract_Opaque>
+Regex_Cache::
+find_opt(phsh_stringR key)
+  {
+    auto qent = this->m_entries.mut_ptr(key);
+    if(!qent) {
+      this->m_misses ++;
+      return nullptr;
+    }
+
+    this->m_hits ++;
+    qent->stamp = ++ this->m_stamp;
+    return qent->value;
+  }
+
+Regex_Cache&
+Regex_Cache::
+insert(phsh_stringR key, const refcnt_ptr<Abstract_Opaque>& value)
+  {
+    if(this->m_capacity == 0)
+      return *this;
+
+    auto qent = this->m_entries.mut_ptr(key);
+    if(!qent) {
+      while(this->m_entries.size() >= this->m_capacity)
+        this->do_evict_lru();
+
+      qent = &(this->m_entries.try_emplace(key).first->second);
+    }
+
+    qent->value = value;
+    qent->stamp = ++ this->m_stamp;
+    return *this;
+  }
+
+Regex_Cache&
+Regex_Cache::
+clear() noexcept
+  {
+    this->m_entries.clear();
+    return *this;
+  }
+
+}  // namespace asteria
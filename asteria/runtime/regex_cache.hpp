@@ -0,0 +1,79 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#ifndef ASTERIA_RUNTIME_REGEX_CACHE_
+#define ASTERIA_RUNTIME_REGEX_CACHE_
+
+#include "../fwd.hpp"
+namespace asteria {
+
+class Regex_Cache final
+  :
+    public rcfwd<Regex_Cache>
+  {
+  private:
+    struct Entry
+      {
+        refcnt_ptr<Abstract_Opaque> value;
+        uint64_t stamp;
+      };
+
+    cow_dictionary<Entry> m_entries;
+    size_t m_capacity = 64;
+    uint64_t m_stamp = 0;
+    uint64_t m_hits = 0;
+    uint64_t m_misses = 0;
+
+  public:
+    explicit
+    Regex_Cache() noexcept
+      {
+      }
+
+  private:
+    void
+    do_evict_lru();
+
+  public:
+    ASTERIA_NONCOPYABLE_DESTRUCTOR(Regex_Cache);
+
+    // These are statistics.
+    size_t
+    size() const noexcept
+      { return this->m_entries.size();  }
+
+    size_t
+    capacity() const noexcept
+      { return this->m_capacity;  }
+
+    uint64_t
+    hits() const noexcept
+      { return this->m_hits;  }
+
+    uint64_t
+    misses() const noexcept
+      { return this->m_misses;  }
+
+    // Sets the maximum number of cached patterns. Least recently used ones are
+    // evicted. A capacity of zero disables caching.
+    Regex_Cache&
+    set_capacity(size_t cap);
+
+    // Looks up a compiled pattern. The key shall include both the pattern and
+    // options that affect compilation. A hit marks the entry as most recently
+    // used.
+    refcnt_ptr<Abstract_Opaque>
+    find_opt(phsh_stringR key);
+
+    // Inserts a compiled pattern, possibly evicting the least recently used
+    // one.
+    Regex_Cache&
+    insert(phsh_stringR key, const refcnt_ptr<Abstract_Opaque>& value);
+
+    // Discards all compiled patterns. Statistics are not reset.
+    Regex_Cache&
+    clear() noexcept;
+  };
+
+}  // namespace asteria
+#endif
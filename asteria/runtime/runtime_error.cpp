@@ -45,7 +45,15 @@ do_insert_frame(Backtrace_Frame&& new_frm)
     this->m_frames.insert(this->m_ins_at, ::std::move(new_frm));
     this->m_ins_at++;
 
-    // Rebuild the message using new frames. The storage may be reused.
+    // Invalidate the message. It will be rebuilt when requested.
+    this->m_fmt_valid = false;
+  }
+
+void
+Runtime_Error::
+do_format_message() const
+  {
+    // Rebuild the message using all frames. The storage may be reused.
     // Strings are written verbatim. All the others are formatted.
     this->m_fmt.clear_string();
     this->m_fmt << "runtime error: ";
@@ -62,6 +70,7 @@ do_insert_frame(Backtrace_Frame&& new_frm)
     sbuf.emplace_back();
 
     // Append stack frames.
+    ::rocket::tinyfmt_str frame_fmt;
     this->m_fmt << "\n[backtrace frames:\n";
     for(size_t k = 0;  k < this->m_frames.size();  ++k) {
       const auto& frm = this->m_frames[k];
@@ -69,19 +78,35 @@ do_insert_frame(Backtrace_Frame&& new_frm)
       ::std::copy_backward(nump.begin(), nump.end(), sbuf.mut_end() - 1);
       format(this->m_fmt, "  $1) $2 at '$3': ", sbuf.data(), frm.what_type(), frm.sloc());
 
-      this->m_frame_fmt.clear_string();
-      frm.value().print(this->m_frame_fmt);
+      frame_fmt.clear_string();
+      frm.value().print(frame_fmt);
 
-      if(this->m_frame_fmt.length() > 120) {
-        size_t nchars_omitted = this->m_frame_fmt.length() - 100;
-        this->m_fmt.putn(this->m_frame_fmt.c_str(), this->m_frame_fmt.length() - nchars_omitted);
-        nump.put_DU(nchars_omitted);
+      if(frame_fmt.length() > 120) {
+        size_t nchars_omitted = frame_fmt.length() - 100;
+        this->m_fmt.putn(frame_fmt.c_str(), frame_fmt.length() - nchars_omitted);
         format(this->m_fmt, " ... ($1 characters omitted)\n", nchars_omitted);
       }
       else
-        this->m_fmt << this->m_frame_fmt.get_string() << '\n';
+        this->m_fmt << frame_fmt.get_string() << '\n';
     }
     this->m_fmt << "  -- end of backtrace frames]";
+    this->m_fmt_valid = true;
+  }
+
+const char*
+Runtime_Error::
+what() const noexcept
+  {
+    if(!this->m_fmt_valid)
+      try {
+        this->do_format_message();
+      }
+      catch(exception& stdex) {
+        ::fprintf(stderr, "WARNING: Could not format runtime error: %s\n", stdex.what());
+        return "runtime error: [message unavailable]";
+      }
+
+    return this->m_fmt.c_str();
   }
 
 }  // namespace asteria
@@ -24,8 +24,10 @@ class Runtime_Error
     cow_vector<Backtrace_Frame> m_frames;
     size_t m_ins_at = 0;  // where to insert new frames
 
-    ::rocket::tinyfmt_str m_fmt;  // human-readable message
-    ::rocket::tinyfmt_str m_frame_fmt;
+    // The human-readable message is built on the first call to `what()`, so
+    // exceptions that are caught by scripts don't pay for formatting.
+    mutable ::rocket::tinyfmt_str m_fmt;
+    mutable bool m_fmt_valid = false;
 
   public:
     template<typename XValT>
@@ -54,17 +56,23 @@ class Runtime_Error
     void
     do_insert_frame(Backtrace_Frame&& new_frm);
 
+    void
+    do_format_message() const;
+
   public:
     ASTERIA_COPYABLE_DESTRUCTOR(Runtime_Error);
 
     const char*
-    what() const noexcept override
-      { return this->m_fmt.c_str();  }
+    what() const noexcept override;
 
     const Value&
     value() const noexcept
       { return this->m_value;  }
 
+    const cow_vector<Backtrace_Frame>&
+    frames() const noexcept
+      { return this->m_frames;  }
+
     size_t
     count_frames() const noexcept
       { return this->m_frames.size();  }
@@ -62,6 +62,7 @@ reload(stringR name, Statement_Sequence&& stmtq)
 
     Source_Location sloc(name, 0, 0);
     this->m_func = optmz.create_function(sloc, sref("[file scope]"));
+    this->m_file.clear();
   }
 
 void
@@ -78,7 +79,7 @@ Simple_Script::
 reload(stringR name, int line, tinybuf&& cbuf)
   {
     Token_Stream tstrm(this->m_opts);
-    tstrm.reload(name, line, ::std::move(cbuf));
+    tstrm.reload(name, line, cbuf);
     this->reload(name, ::std::move(tstrm));
   }
 
@@ -125,9 +126,13 @@ reload_file(const char* path)
           "[`realpath()` failed: ${errno:full}]"),
           path);
 
-    ::rocket::tinybuf_file cbuf;
-    cbuf.open(abspath, tinybuf::open_read);
-    this->reload(cow_string(abspath), 1, ::std::move(cbuf));
+    // Compile the file through the module loader, so it can be checked for
+    // modification later.
+    cow_string file(abspath);
+    const auto loader = this->m_global.module_loader();
+    Module_Loader::Unique_Stream strm(loader, file.c_str());
+    this->m_func = loader->compile_stream(strm, file, this->m_opts, this->m_global);
+    this->m_file = ::std::move(file);
   }
 
 void
@@ -137,6 +142,33 @@ reload_file(stringR path)
     this->reload_file(path.safe_c_str());
   }
 
+cow_vector<Module_Loader::Refresh_Result>
+Simple_Script::
+reload_modified()
+  {
+    // Recompile modules first. If the script file is also in the cache, it
+    // will have been recompiled as needed.
+    const auto loader = this->m_global.module_loader();
+    auto results = loader->refresh_cache(this->m_global);
+    if(this->m_file.empty())
+      return results;
+
+    Module_Loader::Unique_Stream strm(loader, this->m_file.c_str());
+    auto func = loader->get_cached_function_opt(strm, this->m_file, this->m_opts);
+    if(!func) {
+      // The cache is disabled, or options have changed.
+      double t0 = get_monotonic_seconds();
+      func = loader->compile_stream(strm, this->m_file, this->m_opts, this->m_global);
+
+      auto& res = results.emplace_back();
+      res.path = this->m_file;
+      res.recompiled = true;
+      res.compile_seconds = get_monotonic_seconds() - t0;
+    }
+    this->m_func = ::std::move(func);
+    return results;
+  }
+
 Reference
 Simple_Script::
 execute(Reference_Stack&& stack)
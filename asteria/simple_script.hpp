@@ -6,6 +6,7 @@
 
 #include "fwd.hpp"
 #include "runtime/global_context.hpp"
+#include "runtime/module_loader.hpp"
 namespace asteria {
 
 class Simple_Script
@@ -16,6 +17,7 @@ class Simple_Script
 
     cow_vector<phsh_string> m_params;
     cow_function m_func;
+    cow_string m_file;  // absolute path, if loaded from a file
 
   public:
     explicit
@@ -52,7 +54,10 @@ class Simple_Script
 
     void
     reset() noexcept
-      { this->m_func.reset();  }
+      {
+        this->m_func.reset();
+        this->m_file.clear();
+      }
 
     // Manage global variables in the bundled context.
     refcnt_ptr<Variable>
@@ -65,6 +70,8 @@ class Simple_Script
     erase_global_variable(phsh_stringR name) noexcept;
 
     // Load something. Calling these functions directly is not recommended.
+    // A token stream reads from the buffer that it was loaded from, which
+    // must still exist.
     void
     reload(stringR name, Statement_Sequence&& stmtq);
 
@@ -93,6 +100,13 @@ class Simple_Script
     void
     reload_file(stringR path);
 
+    // Recompile the script file if it has been modified since it was loaded,
+    // and modules that have been modified since they were imported. Compiled
+    // code of unchanged files is kept. Returns all files that have been
+    // checked, with compilation time of each.
+    cow_vector<Module_Loader::Refresh_Result>
+    reload_modified();
+
     // Execute the script that has been loaded.
     Reference
     execute(Reference_Stack&& stack);
@@ -3,13 +3,165 @@
 
 #include "precompiled.ipp"
 #include "source_location.hpp"
+#include "../rocket/mutex.hpp"
 namespace asteria {
+namespace {
+
+// File names are stored in fixed-size segments which are never freed, so a
+// name does not move once it has been added, and it can be read without
+// locking. The first entry is reserved for unknown locations.
+// Storage is allocated with `malloc()` rather than `operator new`, as this
+// table lives until the process exits, and it is not a leak of any script.
+constexpr uint32_t s_seg_bits = 10;
+constexpr uint32_t s_seg_size = 1U << s_seg_bits;
+constexpr uint32_t s_max_segs = 1U << 12;
+
+void*
+do_xmalloc(size_t size)
+  {
+    void* ptr = ::malloc(size);
+    if(!ptr)
+      throw ::std::bad_alloc();
+    return ptr;
+  }
+
+size_t
+do_hash_name(const char* str, size_t len) noexcept
+  {
+    // FNV-1a
+    size_t hval = 2166136261U;
+    for(size_t k = 0;  k != len;  ++k)
+      hval = (hval ^ static_cast<unsigned char>(str[k])) * 16777619U;
+    return hval;
+  }
+
+class File_Table
+  {
+  private:
+    ::rocket::mutex m_mutex;
+    cow_string* m_segs[s_max_segs] = { };
+    uint32_t m_count = 0;
+
+    // This is an open-addressing hash table of IDs, plus one, of all entries.
+    uint32_t* m_buckets = nullptr;
+    size_t m_nbuckets = 0;
+
+  public:
+    File_Table()
+      {
+        this->do_append("[unknown]", 9);
+      }
+
+  private:
+    size_t
+    do_probe(const char* str, size_t len) const noexcept
+      {
+        size_t mask = this->m_nbuckets - 1;
+        size_t pos = do_hash_name(str, len) & mask;
+        for(;;) {
+          uint32_t idp1 = this->m_buckets[pos];
+          if(idp1 == 0)
+            return pos;
+
+          const auto& name = this->get(idp1 - 1);
+          if((name.size() == len) && (::memcmp(name.data(), str, len) == 0))
+            return pos;
+
+          pos = (pos + 1) & mask;
+        }
+      }
+
+    void
+    do_rehash(size_t nbuckets)
+      {
+        auto buckets = static_cast<uint32_t*>(do_xmalloc(nbuckets * sizeof(uint32_t)));
+        ::memset(buckets, 0, nbuckets * sizeof(uint32_t));
+        ::free(this->m_buckets);
+        this->m_buckets = buckets;
+        this->m_nbuckets = nbuckets;
+
+        for(uint32_t id = 0;  id != this->m_count;  ++id) {
+          const auto& name = this->get(id);
+          this->m_buckets[this->do_probe(name.data(), name.size())] = id + 1;
+        }
+      }
+
+    uint32_t
+    do_append(const char* str, size_t len)
+      {
+        uint32_t id = this->m_count;
+        if(id >= s_seg_size * s_max_segs)
+          ::rocket::sprintf_and_throw<::std::length_error>(
+              "Source_Location: too many files (limit `%lu`)",
+              static_cast<unsigned long>(s_seg_size * s_max_segs));
+
+        if(this->m_count * 2 >= this->m_nbuckets)
+          this->do_rehash(::std::max<size_t>(this->m_nbuckets * 2, 64));
+
+        auto& seg = this->m_segs[id >> s_seg_bits];
+        if(!seg)
+          seg = static_cast<cow_string*>(do_xmalloc(s_seg_size * sizeof(cow_string)));
+
+        // The name is copied into storage which is never freed, so the string
+        // object does not own it.
+        auto chars = static_cast<char*>(do_xmalloc(len + 1));
+        ::memcpy(chars, str, len);
+        chars[len] = 0;
+        ::new(seg + (id & (s_seg_size - 1))) cow_string(sref(chars));
+
+        this->m_buckets[this->do_probe(str, len)] = id + 1;
+        this->m_count = id + 1;
+        return id;
+      }
+
+  public:
+    const cow_string&
+    get(uint32_t id) const noexcept
+      {
+        ROCKET_ASSERT(id < s_seg_size * s_max_segs);
+        return this->m_segs[id >> s_seg_bits][id & (s_seg_size - 1)];
+      }
+
+    uint32_t
+    intern(stringR file)
+      {
+        ::rocket::mutex::unique_lock lock(this->m_mutex);
+        uint32_t idp1 = this->m_buckets[this->do_probe(file.data(), file.size())];
+        if(idp1 != 0)
+          return idp1 - 1;
+
+        return this->do_append(file.data(), file.size());
+      }
+  };
+
+File_Table&
+do_get_file_table()
+  {
+    static File_Table s_table;
+    return s_table;
+  }
+
+}  // namespace
+
+Source_Location::
+Source_Location(stringR xfile, int xline, int xcolumn)
+  :
+    m_file_id(do_get_file_table().intern(xfile)), m_line(xline), m_column(xcolumn)
+  {
+  }
+
+const cow_string&
+Source_Location::
+file() const noexcept
+  {
+    return do_get_file_table().get(this->m_file_id);
+  }
 
 tinyfmt&
 Source_Location::
 print(tinyfmt& fmt) const
   {
-    return fmt << this->m_file << ':' << this->m_line << ':' << this->m_column;
+    return fmt << this->file() << ':' << this->m_line << ':' << this->m_column;
   }
 
 }  // namespace asteria
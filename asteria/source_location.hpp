@@ -10,40 +10,47 @@ namespace asteria {
 class Source_Location
   {
   private:
-    cow_string m_file;
+    // File names are interned into a global table, so copying a source
+    // location does not touch any reference counter.
+    uint32_t m_file_id;
     int m_line;
     int m_column;
 
   public:
     Source_Location() noexcept
       :
-        m_file(sref("[unknown]")), m_line(-1), m_column(-1)
+        m_file_id(0), m_line(-1), m_column(-1)
       {
       }
 
-    Source_Location(stringR xfile, int xline, int xcolumn) noexcept
+    Source_Location(stringR xfile, int xline, int xcolumn);
+
+    Source_Location(const Source_Location& xfile, int xline, int xcolumn) noexcept
       :
-        m_file(xfile), m_line(xline), m_column(xcolumn)
+        m_file_id(xfile.m_file_id), m_line(xline), m_column(xcolumn)
       {
       }
 
     Source_Location&
     swap(Source_Location& other) noexcept
       {
-        this->m_file.swap(other.m_file);
+        ::std::swap(this->m_file_id, other.m_file_id);
         ::std::swap(this->m_line, other.m_line);
         ::std::swap(this->m_column, other.m_column);
         return *this;
       }
 
   public:
+    uint32_t
+    file_id() const noexcept
+      { return this->m_file_id;  }
+
     const cow_string&
-    file() const noexcept
-      { return this->m_file;  }
+    file() const noexcept;
 
     const char*
     c_file() const noexcept
-      { return this->m_file.c_str();  }
+      { return this->file().c_str();  }
 
     int
     line() const noexcept
@@ -3,11 +3,19 @@
 
 #include "precompiled.ipp"
 #include "utils.hpp"
+#include "runtime/runtime_error.hpp"
 #include <time.h>  // ::timespec, ::clock_gettime(), ::localtime()
 #include <unistd.h>  // ::write
+#include <sys/stat.h>  // ::fstat()
+#include <sys/mman.h>  // ::mmap(), ::munmap(), ::madvise()
+#include <thread>
+#include <atomic>
 namespace asteria {
 namespace {
 
+// This is lowered by tests to take fallback paths.
+atomic_relaxed<uint8_t> s_cpu_features_limit(cpu_features_all);
+
 const char s_char_escapes[][5] =
   {
     "\\0",   "\\x01", "\\x02", "\\x03", "\\x04", "\\x05", "\\x06", "\\a",
@@ -44,6 +52,250 @@ const char s_char_escapes[][5] =
     "\\xF8", "\\xF9", "\\xFA", "\\xFB", "\\xFC", "\\xFD", "\\xFE", "\\xFF",
   };
 
+// ASCII scanning
+// These functions return the number of leading bytes that are less than 0x80,
+// whose most significant bits can be collected with `pmovmskb`.
+size_t
+do_ascii_prefix_sse2(const char* str, size_t len) noexcept
+  {
+    size_t off = 0;
+    while(len - off >= 16) {
+      __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + off));
+      uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(t));
+      if(mask != 0)
+        return off + ROCKET_TZCNT32(mask);
+
+      off += 16;
+    }
+
+    while((off != len) && (static_cast<uint8_t>(str[off]) < 0x80))
+      off ++;
+    return off;
+  }
+
+ROCKET_TARGET("avx2")
+size_t
+do_ascii_prefix_avx2(const char* str, size_t len) noexcept
+  {
+    size_t off = 0;
+    while(len - off >= 32) {
+      __m256i t = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + off));
+      uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(t));
+      if(mask != 0)
+        return off + ROCKET_TZCNT32(mask);
+
+      off += 32;
+    }
+    return off + do_ascii_prefix_sse2(str + off, len - off);
+  }
+
+// UTF-8 validation
+// This is the lookup algorithm by John Keiser and Daniel Lemire. Errors that
+// involve two adjacent bytes are found by looking up the high and low nibbles
+// of the first byte and the high nibble of the second byte in three tables,
+// and intersecting the results. Each bit denotes a kind of error, as follows:
+//
+//   0x01  too short: a leading byte followed by ASCII or another leading byte
+//   0x02  too long: ASCII followed by a continuation byte
+//   0x04  overlong 3-byte sequence: 11100000 100_____
+//   0x08  too large: 11110100 1001____, 11110100 101_____, 11110101+ 10______
+//   0x10  surrogate: 11101101 101_____
+//   0x20  overlong 2-byte sequence: 1100000_ 10______
+//   0x40  overlong 4-byte sequence: 11110000 1000____, or too large
+//   0x80  two continuation bytes
+//
+// Two continuation bytes are valid, if and only if they are the third or the
+// fourth byte of a sequence, which is checked by flipping bit 0x80.
+// Sequences that are incomplete at the end of a block are carried to the
+// next one, or are errors at the end of input.
+alignas(16) constexpr uint8_t s_utf8_byte_1_high[16] =
+  {
+    0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+    0x80, 0x80, 0x80, 0x80, 0x21, 0x01, 0x15, 0x49,
+  };
+
+alignas(16) constexpr uint8_t s_utf8_byte_1_low[16] =
+  {
+    0xE7, 0xA3, 0x83, 0x83, 0x8B, 0xCB, 0xCB, 0xCB,
+    0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xDB, 0xCB, 0xCB,
+  };
+
+alignas(16) constexpr uint8_t s_utf8_byte_2_high[16] =
+  {
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0xE6, 0xAE, 0xBA, 0xBA, 0x01, 0x01, 0x01, 0x01,
+  };
+
+size_t
+do_utf8_valid_prefix_scalar(const char* str, size_t len, size_t off) noexcept
+  {
+    while(off != len) {
+      const char* pos = str + off;
+      char32_t cp;
+      if(!utf8_decode(cp, pos, len - off))
+        return off;
+
+      off = static_cast<size_t>(pos - str);
+    }
+    return off;
+  }
+
+size_t
+do_utf8_locate_error(const char* str, size_t len, size_t off) noexcept
+  {
+    // All bytes before `off` are valid, except that the last sequence may be
+    // incomplete, so back up to its leading byte, then locate the error with
+    // the scalar decoder. If the last three bytes are all continuation bytes,
+    // they must have terminated a sequence.
+    size_t from = off;
+    for(size_t k = 1;  (k <= 3) && (k <= off);  ++k)
+      if((static_cast<uint8_t>(str[off - k]) & 0xC0) != 0x80) {
+        from = off - k;
+        break;
+      }
+    return do_utf8_valid_prefix_scalar(str, len, from);
+  }
+
+ROCKET_TARGET("ssse3")
+__m128i
+do_utf8_check_ssse3(__m128i input, __m128i prev_input) noexcept
+  {
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+    __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+    __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+
+    __m128i t = _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(s_utf8_byte_1_high)),
+                                 _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+    t = _mm_and_si128(t, _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(s_utf8_byte_1_low)),
+                                          _mm_and_si128(prev1, nibble)));
+    t = _mm_and_si128(t, _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(s_utf8_byte_2_high)),
+                                          _mm_and_si128(_mm_srli_epi16(input, 4), nibble)));
+
+    // Set bit 0x80 where a third or fourth byte is expected.
+    __m128i must23 = _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+                                  _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80))));
+    return _mm_xor_si128(t, _mm_and_si128(must23, _mm_set1_epi8(static_cast<char>(0x80))));
+  }
+
+ROCKET_TARGET("ssse3")
+size_t
+do_utf8_valid_prefix_ssse3(const char* str, size_t len) noexcept
+  {
+    const __m128i incomplete_max = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                                 -1, -1, -1, -1, -1, static_cast<char>(0xEF),
+                                                 static_cast<char>(0xDF), static_cast<char>(0xBF));
+    const __m128i zero = _mm_setzero_si128();
+    __m128i prev_input = zero;
+    __m128i prev_incomplete = zero;
+    size_t off = 0;
+
+    while(off < len) {
+      // Load a block. The last one is padded with zeroes, which are ASCII
+      // characters and terminate incomplete sequences.
+      __m128i input;
+      if(len - off >= 16)
+        input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(str + off));
+      else {
+        alignas(16) char temp[16] = { };
+        ::memcpy(temp, str + off, len - off);
+        input = _mm_load_si128(reinterpret_cast<const __m128i*>(temp));
+      }
+
+      __m128i errors = prev_incomplete;
+      if(_mm_movemask_epi8(input) == 0)
+        prev_incomplete = zero;
+      else {
+        errors = do_utf8_check_ssse3(input, prev_input);
+        prev_incomplete = _mm_subs_epu8(input, incomplete_max);
+      }
+
+      if(_mm_movemask_epi8(_mm_cmpeq_epi8(errors, zero)) != 0xFFFF)
+        return do_utf8_locate_error(str, len, off);
+
+      prev_input = input;
+      off += 16;
+    }
+
+    if(_mm_movemask_epi8(_mm_cmpeq_epi8(prev_incomplete, zero)) != 0xFFFF)
+      return do_utf8_locate_error(str, len, len);
+
+    return len;
+  }
+
+ROCKET_TARGET("avx2")
+__m256i
+do_utf8_check_avx2(__m256i input, __m256i prev_input) noexcept
+  {
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    __m256i shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+    __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+    __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+
+    __m256i t = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(
+                                         reinterpret_cast<const __m128i*>(s_utf8_byte_1_high))),
+                                    _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+    t = _mm256_and_si256(t, _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(
+                                                     reinterpret_cast<const __m128i*>(s_utf8_byte_1_low))),
+                                                _mm256_and_si256(prev1, nibble)));
+    t = _mm256_and_si256(t, _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_load_si128(
+                                                     reinterpret_cast<const __m128i*>(s_utf8_byte_2_high))),
+                                                _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble)));
+
+    // Set bit 0x80 where a third or fourth byte is expected.
+    __m256i must23 = _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80))),
+                                     _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80))));
+    return _mm256_xor_si256(t, _mm256_and_si256(must23, _mm256_set1_epi8(static_cast<char>(0x80))));
+  }
+
+ROCKET_TARGET("avx2")
+size_t
+do_utf8_valid_prefix_avx2(const char* str, size_t len) noexcept
+  {
+    const __m256i incomplete_max = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                                    -1, -1, -1, -1, -1, -1, -1, -1,
+                                                    -1, -1, -1, -1, -1, -1, -1, -1,
+                                                    -1, -1, -1, -1, -1, static_cast<char>(0xEF),
+                                                    static_cast<char>(0xDF), static_cast<char>(0xBF));
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i prev_input = zero;
+    __m256i prev_incomplete = zero;
+    size_t off = 0;
+
+    while(off < len) {
+      // Load a block. The last one is padded with zeroes, which are ASCII
+      // characters and terminate incomplete sequences.
+      __m256i input;
+      if(len - off >= 32)
+        input = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(str + off));
+      else {
+        alignas(32) char temp[32] = { };
+        ::memcpy(temp, str + off, len - off);
+        input = _mm256_load_si256(reinterpret_cast<const __m256i*>(temp));
+      }
+
+      __m256i errors = prev_incomplete;
+      if(_mm256_movemask_epi8(input) == 0)
+        prev_incomplete = zero;
+      else {
+        errors = do_utf8_check_avx2(input, prev_input);
+        prev_incomplete = _mm256_subs_epu8(input, incomplete_max);
+      }
+
+      if(!_mm256_testz_si256(errors, errors))
+        return do_utf8_locate_error(str, len, off);
+
+      prev_input = input;
+      off += 32;
+    }
+
+    if(!_mm256_testz_si256(prev_incomplete, prev_incomplete))
+      return do_utf8_locate_error(str, len, len);
+
+    return len;
+  }
+
 }  // namespace
 
 ptrdiff_t
@@ -293,6 +545,26 @@ utf8_decode(char32_t& cp, stringR text, size_t& offset)
     return true;
   }
 
+size_t
+ascii_prefix_length(const char* str, size_t len) noexcept
+  {
+    if(cpu_has_avx2())
+      return do_ascii_prefix_avx2(str, len);
+    else
+      return do_ascii_prefix_sse2(str, len);
+  }
+
+size_t
+utf8_valid_prefix_length(const char* str, size_t len) noexcept
+  {
+    if(cpu_has_avx2())
+      return do_utf8_valid_prefix_avx2(str, len);
+    else if(cpu_has_ssse3())
+      return do_utf8_valid_prefix_ssse3(str, len);
+    else
+      return do_utf8_valid_prefix_scalar(str, len, do_ascii_prefix_sse2(str, len));
+  }
+
 bool
 utf16_encode(char16_t*& pos, char32_t cp) noexcept
   {
@@ -401,4 +673,124 @@ c_quote(cow_string& str, const char* data, size_t size)
     return str;
   }
 
+Mapped_File::
+Mapped_File(int fd) noexcept
+  {
+    struct ::stat info;
+    if((::fstat(fd, &info) != 0) || !S_ISREG(info.st_mode))
+      return;
+
+    // Don't map files smaller than 256KiB.
+    if((info.st_size < 0x40000) || ((uint64_t) info.st_size > PTRDIFF_MAX))
+      return;
+
+    size_t size = static_cast<size_t>(info.st_size);
+    void* ptr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if(ptr == MAP_FAILED)
+      return;
+
+    // Files are usually read from the beginning to the end, so ask for more
+    // aggressive read-ahead. This is only a hint.
+    ::madvise(ptr, size, MADV_SEQUENTIAL);
+    this->m_ptr = ptr;
+    this->m_size = size;
+  }
+
+Mapped_File::
+~Mapped_File()
+  {
+    if(this->m_ptr)
+      ::munmap(this->m_ptr, this->m_size);
+  }
+
+void
+parallel_for_each(size_t count, size_t nthreads, void* ctx, void callback(void*, size_t))
+  {
+    ::std::atomic<size_t> next(0);
+    ::std::atomic<bool> failed(false);
+    ::std::exception_ptr eptr;
+
+    auto worker = [&] {
+      size_t index;
+      while(!failed.load(::std::memory_order_relaxed)
+            && ((index = next.fetch_add(1, ::std::memory_order_relaxed)) < count))
+        try {
+          callback(ctx, index);
+        }
+        catch(...) {
+          // Keep only the first exception.
+          if(!failed.exchange(true))
+            eptr = ::std::current_exception();
+        }
+    };
+
+    // The calling thread is also a worker. If a thread cannot be created,
+    // fewer threads are used.
+    ::std::vector<::std::thread> threads;
+    try {
+      for(size_t k = 1;  k < ::std::min(nthreads, count);  ++k)
+        threads.emplace_back(worker);
+    }
+    catch(::std::system_error&) { }
+
+    worker();
+    for(auto& thr : threads)
+      thr.join();
+
+    if(eptr)
+      ::std::rethrow_exception(eptr);
+  }
+
+size_t
+get_processor_count() noexcept
+  {
+    long ncpus = ::sysconf(_SC_NPROCESSORS_ONLN);
+    return (ncpus > 0) ? static_cast<size_t>(ncpus) : 1;
+  }
+
+size_t
+get_thread_count(const optV_integer& threads)
+  {
+    if(!threads)
+      return 1;
+
+    if(*threads < 0)
+      ASTERIA_THROW_RUNTIME_ERROR((
+          "Thread count not valid (threads `$1`)"),
+          *threads);
+
+    if(*threads == 0)
+      return get_processor_count();
+
+    return ::rocket::clamp_cast<size_t>(*threads, 1, 1024);
+  }
+
+double
+get_monotonic_seconds() noexcept
+  {
+    ::timespec ts;
+    ::clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1.0e-9;
+  }
+
+bool
+cpu_has_ssse3() noexcept
+  {
+    static const bool s_ssse3 = ROCKET_CPU_SUPPORTS("ssse3");
+    return s_ssse3 && (s_cpu_features_limit.load() >= cpu_features_ssse3);
+  }
+
+bool
+cpu_has_avx2() noexcept
+  {
+    static const bool s_avx2 = ROCKET_CPU_SUPPORTS("avx2");
+    return s_avx2 && (s_cpu_features_limit.load() >= cpu_features_avx2);
+  }
+
+void
+limit_cpu_features(CPU_Feature_Level level) noexcept
+  {
+    s_cpu_features_limit.store(level);
+  }
+
 }  // namespace asteria
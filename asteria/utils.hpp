@@ -263,6 +263,16 @@ utf8_decode(char32_t& cp, const char*& pos, size_t avail) noexcept;
 bool
 utf8_decode(char32_t& cp, stringR text, size_t& offset);
 
+// These are fast paths for bulk text. `ascii_prefix_length()` returns the
+// number of leading bytes that are ASCII characters. `utf8_valid_prefix_length()`
+// returns the number of leading bytes that form a valid UTF-8 string, which
+// equals `len` if the whole string is valid.
+size_t
+ascii_prefix_length(const char* str, size_t len) noexcept;
+
+size_t
+utf8_valid_prefix_length(const char* str, size_t len) noexcept;
+
 // UTF-16 conversion functions
 bool
 utf16_encode(char16_t*& pos, char32_t cp) noexcept;
@@ -283,5 +293,93 @@ c_quote(tinyfmt& fmt, const char* data, size_t size);
 cow_string&
 c_quote(cow_string& str, const char* data, size_t size);
 
+// Read-only file mapping
+// Only regular files that are large enough are mapped, as mapping small files
+// costs more than reading them. If the file is not mapped, this object is
+// empty, and the caller shall read the file instead. If the file is truncated
+// while it is mapped, accessing pages beyond its end raises `SIGBUS`.
+class Mapped_File
+  {
+  private:
+    void* m_ptr = nullptr;
+    size_t m_size = 0;
+
+  public:
+    explicit
+    Mapped_File(int fd) noexcept;
+
+    Mapped_File(const Mapped_File&) = delete;
+    Mapped_File& operator=(const Mapped_File&) = delete;
+    ~Mapped_File();
+
+  public:
+    explicit operator
+    bool() const noexcept
+      { return this->m_ptr != nullptr;  }
+
+    const char*
+    data() const noexcept
+      { return static_cast<const char*>(this->m_ptr);  }
+
+    size_t
+    size() const noexcept
+      { return this->m_size;  }
+  };
+
+// Parallel loops
+// `func(ctx, index)` is called for each index in `[0,count)` on up to
+// `nthreads` threads, including the calling one. If a call throws an
+// exception, no more indices are taken, and the first exception is rethrown
+// after all threads have stopped. As workers run without a `Global_Context`,
+// `func` shall not touch script values that may be shared.
+void
+parallel_for_each(size_t count, size_t nthreads, void* ctx, void callback(void*, size_t));
+
+template<typename xFunc>
+inline
+void
+parallel_for_each(size_t count, size_t nthreads, xFunc&& func)
+  {
+    using func_type = typename ::std::remove_reference<xFunc>::type;
+    parallel_for_each(count, nthreads,
+        const_cast<void*>(static_cast<const void*>(::std::addressof(func))),
+        [](void* ctx, size_t index) { (*static_cast<func_type*>(ctx))(index);  });
+  }
+
+// Gets the number of processors that are online.
+size_t
+get_processor_count() noexcept;
+
+// Gets the number of threads to use for an optional `threads` argument of a
+// library function. If `threads` is null, the default is one thread, so no
+// thread is created. If `threads` is zero, the number of processors is used.
+// An exception is thrown if `threads` is negative.
+size_t
+get_thread_count(const optV_integer& threads);
+
+// Gets the time of a monotonic clock in seconds, for measuring intervals.
+double
+get_monotonic_seconds() noexcept;
+
+// These check whether instruction sets for fast paths are available. The
+// level can be lowered with `limit_cpu_features()`, so fallback paths can be
+// tested on any CPU.
+enum CPU_Feature_Level : uint8_t
+  {
+    cpu_features_sse2   = 0,  // baseline of x86-64
+    cpu_features_ssse3  = 1,
+    cpu_features_avx2   = 2,
+    cpu_features_all    = UINT8_MAX,
+  };
+
+bool
+cpu_has_ssse3() noexcept;
+
+bool
+cpu_has_avx2() noexcept;
+
+void
+limit_cpu_features(CPU_Feature_Level level) noexcept;
+
 }  // namespace asteria
 #endif
@@ -409,7 +409,7 @@ class cow_hashmap
         if(!this->m_sth.unique())
           return this->do_deallocate();
 
-        this->m_sth.erase_range_unchecked(0, this->size());
+        this->m_sth.erase_range_unchecked(0, this->bucket_count());
         return *this;
       }
 
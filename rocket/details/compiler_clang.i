@@ -16,11 +16,13 @@
 #define ROCKET_ALWAYS_INLINE                __attribute__((__always_inline__)) __inline__
 #define ROCKET_COLD                         __attribute__((__cold__))
 #define ROCKET_HOT                          __attribute__((__hot__))
+#define ROCKET_TARGET(...)                  __attribute__((__target__(__VA_ARGS__)))
 
 #define ROCKET_UNREACHABLE()                __builtin_unreachable()
 #define ROCKET_EXPECT(...)                  __builtin_expect(!!(__VA_ARGS__), 1)
 #define ROCKET_UNEXPECT(...)                __builtin_expect(!!(__VA_ARGS__), 0)
 #define ROCKET_CONSTANT_P(...)              __builtin_constant_p(__VA_ARGS__)
+#define ROCKET_CPU_SUPPORTS(...)            __builtin_cpu_supports(__VA_ARGS__)
 
 #define ROCKET_FUNCSIG                      __PRETTY_FUNCTION__
 
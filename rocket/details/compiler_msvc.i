@@ -16,11 +16,13 @@
 #define ROCKET_ALWAYS_INLINE                __forceinline
 #define ROCKET_COLD                         // not implemented
 #define ROCKET_HOT                          // not implemented
+#define ROCKET_TARGET(...)                  // not implemented
 
 #define ROCKET_UNREACHABLE()                __assume(0)
 #define ROCKET_EXPECT(...)                  (__VA_ARGS__)  // not implemented
 #define ROCKET_UNEXPECT(...)                (__VA_ARGS__)  // not implemented
 #define ROCKET_CONSTANT_P(...)              false  // not implemented
+#define ROCKET_CPU_SUPPORTS(...)            false  // not implemented
 
 #define ROCKET_FUNCSIG                      __FUNCSIG__
 
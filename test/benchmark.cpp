@@ -0,0 +1,239 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+#include "../asteria/runtime/reference.hpp"
+#include "../asteria/runtime/global_context.hpp"
+#include "../asteria/library/string.hpp"
+#include "../asteria/library/json.hpp"
+#include "../asteria/utils.hpp"
+using namespace ::asteria;
+
+// This program measures the speed of some operations. It is not run by
+// `make check`, as results depend on the machine and its load. Build it with
+// `make test/benchmark.test`. If arguments are given, only benchmarks whose
+// names contain any of them are run.
+
+namespace {
+
+void
+do_report(const char* name, const char* what, double count, const char* unit, double secs)
+  {
+    ::fprintf(stderr, "%-16s %-24s %12.1f %s/s\n", name, what, count / (secs + 1.0e-12), unit);
+  }
+
+void
+do_report_bytes(const char* name, const char* what, size_t size, size_t nbytes, double secs)
+  {
+    char str[64];
+    ::snprintf(str, sizeof(str), "%s %zu B", what, size);
+    do_report(name, str, (double) nbytes / 1048576.0, "MiB", secs);
+  }
+
+cow_string
+do_make_text(size_t size)
+  {
+    static constexpr char s_words[][8] =
+      {
+        "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+        "lorem", "ipsum", "\t", "\n", "0123", "{\"k\":", "\xE4\xB8\xAD", "a",
+      };
+
+    cow_string text;
+    text.reserve(size);
+    uint32_t seed = 1;
+    while(text.size() < size) {
+      seed = seed * 1103515245U + 12345U;
+      text.append(s_words[(seed >> 16) % (sizeof(s_words) / sizeof(*s_words))]);
+      text.push_back(' ');
+    }
+    text.erase(size);
+    return text;
+  }
+
+void
+do_function_call(const char* name)
+  {
+    static constexpr char s_source[] =
+      R"__(
+        func id(x) { return x;  }
+        func add(a, b) { return a + b;  }
+        var s = 0;
+        for(var i = 0;  i < 1000000;  ++i)
+          s = add(s, id(i & 3));
+        return s;
+      )__";
+
+    for(bool ptc : { false, true }) {
+      Simple_Script code;
+      code.options().proper_tail_calls = ptc;
+      code.reload_string(sref("benchmark"), 1, sref(s_source));
+
+      double t0 = get_monotonic_seconds();
+      code.execute();
+      double secs = get_monotonic_seconds() - t0;
+      do_report(name, ptc ? "proper_tail_calls 1" : "proper_tail_calls 0", 2.0e6, "calls", secs);
+    }
+  }
+
+void
+do_string_search(const char* name)
+  {
+    for(size_t size : { 1024U, 65536U, 1048576U }) {
+      const cow_string text = do_make_text(size);
+      size_t nloop = 1 + (64U << 20) / (size + 256);
+
+      // These patterns are not found, so whole texts are scanned.
+      double t0 = get_monotonic_seconds();
+      for(size_t k = 0;  k != nloop;  ++k)
+        std_string_find(text, 0, nullopt, sref("lazy dog!"));
+      do_report_bytes(name, "find", size, nloop * size, get_monotonic_seconds() - t0);
+
+      t0 = get_monotonic_seconds();
+      for(size_t k = 0;  k != nloop;  ++k)
+        std_string_find_any_of(text, 0, nullopt, sref("#%&"));
+      do_report_bytes(name, "find_any_of", size, nloop * size, get_monotonic_seconds() - t0);
+
+      t0 = get_monotonic_seconds();
+      for(size_t k = 0;  k != nloop;  ++k)
+        std_string_translate(text, sref("aeiou\t"), sref("AEIOU"));
+      do_report_bytes(name, "translate", size, nloop * size, get_monotonic_seconds() - t0);
+    }
+  }
+
+template<typename xFunc>
+void
+do_bench_codec(const char* name, const char* what, const cow_string& input, xFunc&& func)
+  {
+    size_t nloop = 1 + (16U << 20) / (input.size() + 256);
+    double t0 = get_monotonic_seconds();
+    for(size_t k = 0;  k != nloop;  ++k)
+      func(input);
+    do_report_bytes(name, what, input.size(), nloop * input.size(), get_monotonic_seconds() - t0);
+  }
+
+void
+do_string_codec(const char* name)
+  {
+    for(size_t size : { 64U, 4096U, 1048576U }) {
+      cow_string input;
+      uint32_t seed = 1;
+      while(input.size() < size) {
+        seed = seed * 1103515245U + 12345U;
+        input.push_back(static_cast<char>(seed >> 16));
+      }
+
+      const cow_string ascii = std_string_base64_encode(input).substr(0, size);
+      do_bench_codec(name, "hex_encode", input, [](const cow_string& s) { return std_string_hex_encode(s, nullopt);  });
+      do_bench_codec(name, "hex_decode", std_string_hex_encode(input, nullopt), std_string_hex_decode);
+      do_bench_codec(name, "base32_encode", input, std_string_base32_encode);
+      do_bench_codec(name, "base32_decode", std_string_base32_encode(input), std_string_base32_decode);
+      do_bench_codec(name, "base64_encode", input, std_string_base64_encode);
+      do_bench_codec(name, "base64_decode", std_string_base64_encode(input), std_string_base64_decode);
+      do_bench_codec(name, "url_encode", ascii, std_string_url_encode);
+      do_bench_codec(name, "url_decode", std_string_url_encode(ascii), std_string_url_decode);
+    }
+  }
+
+void
+do_utf8(const char* name)
+  {
+    for(const char* unit : { "The quick brown fox jumps over the lazy dog. ", "\xE4\xB8\xAD\xE6\x96\x87 abc " }) {
+      cow_string text;
+      while(text.size() < 1048576U)
+        text.append(unit);
+
+      size_t nloop = 64;
+      double t0 = get_monotonic_seconds();
+      for(size_t k = 0;  k != nloop;  ++k)
+        utf8_valid_prefix_length(text.data(), text.size());
+      do_report_bytes(name, (unit[0] == 'T') ? "validate ASCII" : "validate CJK",
+                      text.size(), nloop * text.size(), get_monotonic_seconds() - t0);
+    }
+  }
+
+void
+do_json_format(const char* name)
+  {
+    V_array array;
+    for(int64_t k = 0;  k != 20000;  ++k) {
+      V_object object;
+      object.try_emplace(sref("id"), k);
+      object.try_emplace(sref("name"), cow_string(static_cast<size_t>(k % 50), 'x') + "\t\xE5\x96\xB5");
+      object.try_emplace(sref("score"), static_cast<double>(k) / 7);
+      object.try_emplace(sref("tags"), V_array{ true, nullopt, sref("a\"b") });
+      array.emplace_back(::std::move(object));
+    }
+    const Value value = ::std::move(array);
+
+    size_t nloop = 8;
+    size_t nbytes = 0;
+    double t0 = get_monotonic_seconds();
+    for(size_t k = 0;  k != nloop;  ++k)
+      nbytes += std_json_format(value, nullopt, nullopt).size();
+    do_report_bytes(name, "format", nbytes / nloop, nbytes, get_monotonic_seconds() - t0);
+  }
+
+void
+do_exception(const char* name)
+  {
+    static constexpr char s_source[] =
+      R"__(
+        func check(x) { if(x < 0) throw "negative";  return x;  }
+        var count = 0;
+        for(var i = 0;  i < 200000;  ++i)
+          try
+            check(i % 2 - 1);
+          catch(e)
+            ++count;
+        return count;
+      )__";
+
+    Simple_Script code;
+    code.reload_string(sref("benchmark"), 1, sref(s_source));
+
+    double t0 = get_monotonic_seconds();
+    code.execute();
+    do_report(name, "throw and catch", 1.0e5, "exceptions", get_monotonic_seconds() - t0);
+  }
+
+void
+do_global_context(const char* name)
+  {
+    size_t nloop = 10000;
+    double t0 = get_monotonic_seconds();
+    for(size_t k = 0;  k != nloop;  ++k)
+      Global_Context().max_api_version();
+    do_report(name, "create and destroy", (double) nloop, "contexts", get_monotonic_seconds() - t0);
+  }
+
+struct Benchmark
+  {
+    const char* name;
+    void (*run)(const char* name);
+  }
+constexpr s_benchmarks[] =
+  {
+    { "function_call",  do_function_call  },
+    { "string_search",  do_string_search  },
+    { "string_codec",   do_string_codec   },
+    { "utf8",           do_utf8           },
+    { "json_format",    do_json_format    },
+    { "exception",      do_exception      },
+    { "global_context", do_global_context },
+  };
+
+}  // namespace
+
+int main(int argc, char** argv)
+  {
+    for(const auto& bench : s_benchmarks) {
+      bool selected = argc <= 1;
+      for(int k = 1;  k < argc;  ++k)
+        selected |= ::strstr(bench.name, argv[k]) != nullptr;
+
+      if(selected)
+        bench.run(bench.name);
+    }
+  }
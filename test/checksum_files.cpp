@@ -0,0 +1,55 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+using namespace ::asteria;
+
+int main()
+  {
+    Simple_Script code;
+    code.reload_string(
+      sref(__FILE__), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        const chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+        // We presume this random string will never match any real files.
+        var dname = ".checksum_files-test_dir_" + std.string.implode(std.array.shuffle(std.string.explode(chars)));
+        std.filesystem.dir_create(dname);
+
+        // Files of various sizes, including empty ones and ones that are
+        // large enough to be mapped.
+        var paths = [];
+        for(var i = 0;  i < 200;  ++i) {
+          var path = std.string.format("$1/$2.dat", dname, i);
+          var size = (i % 50 == 7) ? 300000 + i : i * 37 % 5000;
+          std.filesystem.file_write(path, std.string.format("$1;", i) * (size / 4));
+          paths[$] = path;
+        }
+
+        for(each i, name -> [ "crc32", "fnv1a32", "md5", "sha1", "sha224", "sha256", "sha384", "sha512" ]) {
+          var hash_file = std.checksum[name + "_file"];
+          var hash_files = std.checksum[name + "_files"];
+
+          for(each k, threads -> [ null, 0, 1, 7 ]) {
+            var sums = hash_files(paths, threads);
+            assert countof sums == countof paths;
+            for(each i, path -> paths)
+              assert sums[path] == hash_file(path);
+          }
+        }
+
+        assert countof std.checksum.sha256_files([]) == 0;
+        assert countof std.checksum.md5_files([ paths[0], paths[0], paths[1] ]) == 2;
+        assert catch( std.checksum.md5_files(paths, -1) ) != null;
+        assert catch( std.checksum.md5_files([ paths[0], 42 ]) ) != null;
+        assert catch( std.checksum.md5_files([ paths[0], dname + "/nonexistent" ], 4) ) != null;
+
+        for(each i, path -> paths)
+          std.filesystem.file_remove(path);
+        std.filesystem.dir_remove(dname);
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+    code.execute();
+  }
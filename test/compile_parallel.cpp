@@ -0,0 +1,81 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+#include "../asteria/compiler/compiler_error.hpp"
+#include "../asteria/runtime/reference.hpp"
+#include "../rocket/tinyfmt_str.hpp"
+using namespace ::asteria;
+
+namespace {
+
+cow_string
+do_run(const cow_string& source, int nthreads)
+  {
+    Simple_Script code;
+    code.options().compilation_threads = static_cast<uint8_t>(nthreads);
+    code.reload_string(sref("compile_parallel"), 1, source);
+
+    ::rocket::tinyfmt_str fmt;
+    code.execute().dereference_readonly().dump(fmt);
+    return fmt.extract_string();
+  }
+
+int
+do_error_line(const cow_string& source, int nthreads)
+  {
+    Simple_Script code;
+    code.options().compilation_threads = static_cast<uint8_t>(nthreads);
+    try {
+      code.reload_string(sref("compile_parallel"), 1, source);
+    }
+    catch(Compiler_Error& except) {
+      return except.line();
+    }
+    return -1;
+  }
+
+}  // namespace
+
+int main()
+  {
+    // Names that are declared after a function shall not be visible in it,
+    // no matter which thread generates its body.
+    ::rocket::tinyfmt_str fmt;
+    fmt << "var r = [];\n";
+    for(int k = 0;  k != 64;  ++k) {
+      fmt << "func f" << k << "(x) { return std.string.format(\"$1/$2\", x, " << k << ");  }\n";
+      fmt << "var v" << k << " = f" << k << "(" << k * 3 << ");\n";
+      if(k == 30)
+        fmt << "var std = { string: { format: func(...) { return \"L\";  } } };\n";
+      fmt << "func g" << k << "() { return v" << k << " + \",\" + std.string.format(\"$1\", 1);  }\n";
+      fmt << "r[$] = g" << k << "();\n";
+    }
+    fmt << "return r;\n";
+    cow_string source = fmt.extract_string();
+
+    cow_string expect = do_run(source, 1);
+    ASTERIA_TEST_CHECK(expect.find("\"3/1,1\"") != cow_string::npos);
+    ASTERIA_TEST_CHECK(expect.find("\"90/30,L\"") != cow_string::npos);
+    ASTERIA_TEST_CHECK(expect.find("\"L,L\"") != cow_string::npos);
+    for(int nthreads : { 0, 2, 3, 4, 7, 64 })
+      ASTERIA_TEST_CHECK(do_run(source, nthreads) == expect);
+
+    // The first error in source order shall be reported.
+    fmt.clear_string();
+    for(int k = 0;  k != 20;  ++k)
+      fmt << "func f" << k << "() { return " << k << ";  }\n";
+    fmt << "func bad() { return later;  }\n";  // line 21
+    for(int k = 0;  k != 20;  ++k)
+      fmt << "func h" << k << "() { return " << k << ";  }\n";
+    fmt << "var later = nonexistent;\n";  // line 42
+    source = fmt.extract_string();
+
+    for(int nthreads : { 1, 2, 4 })
+      ASTERIA_TEST_CHECK(do_error_line(source, nthreads) == 21);
+
+    source.replace(source.find("later;  }"), 5, "f1()");
+    for(int nthreads : { 1, 2, 4 })
+      ASTERIA_TEST_CHECK(do_error_line(source, nthreads) == 42);
+  }
@@ -23,6 +23,19 @@ int main()
         assert rows[3] == [ 'a', 'nested', "line\nbreak", 'is', 'acceptible' ];
         assert rows[4] == [ 'a bc"d e"', '4' ];
 
+        assert std.csv.parse("") == [];
+        assert std.csv.parse("\xEF\xBB\xBFa,b\r\n\r\n,\nc\r") == [ ['a','b'], [], ['',''], ['c'] ];
+        assert std.csv.parse("a\rb,\"c\r\nd\",\"e\"\"\"\n\"f\"\n") == [ ["a\rb", "c\nd", "e\""], ['f'] ];
+        assert std.csv.parse("\"a\n\nb\"") == [ ["a\n\nb"] ];
+        assert catch( std.csv.parse("a,\"b\n") ) != null;
+
+        assert std.csv.parse("1,2.5,x,y\n-3,,,z", ["integer", "real", null, "string"]) == [ [1, 2.5, 'x', 'y'], [-3, null, '', 'z'] ];
+        assert std.csv.parse("1,2\n3,4", ["real"]) == [ [1.0, '2'], [3.0, '4'] ];
+        assert catch( std.csv.parse("1.5", ["integer"]) ) != null;
+        assert catch( std.csv.parse("99999999999999999999", ["integer"]) ) != null;
+        assert catch( std.csv.parse("x", ["real"]) ) != null;
+        assert catch( std.csv.parse("1", ["boolean"]) ) != null;
+
 ///////////////////////////////////////////////////////////////////////////////
       )__"));
     code.execute();
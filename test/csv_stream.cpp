@@ -0,0 +1,75 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+using namespace ::asteria;
+
+int main()
+  {
+    Simple_Script code;
+    code.reload_string(
+      sref(__FILE__), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        const chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+        // We presume this random string will never match any real files.
+        var fname = ".csv_stream-test_file_" + std.string.implode(std.array.shuffle(std.string.explode(chars)));
+
+        // rows which span multiple blocks, with CR LF pairs and quoted line
+        // breaks across block boundaries
+        var lines = [];
+        for(var i = 0;  i < 60000;  ++i)
+          lines[$] = std.string.format("$1,\"name #$1\r\n\"\"q\"\"\",$2,$3\r", i, i / 4.0, "x" * (i % 29));
+        std.filesystem.file_write(fname, std.string.implode(lines, "\n"));
+
+        var next = 0;
+        assert std.csv.parse_stream(fname,
+            func(index, row) {
+              assert index == next++;
+              assert row[0] == index;
+              assert row[1] == std.string.format("name #$1\n\"q\"", index);
+              assert row[2] == index / 4.0;
+              assert countof row[3] == index % 29;
+            },
+            ["integer", null, "real"]) == 60000;
+        assert next == 60000;
+
+        // batches
+        var sizes = [];
+        next = 0;
+        assert std.csv.parse_stream(fname,
+            func(index, rows) {
+              assert index == next;
+              assert rows[0][0] == std.string.format("$1", index);
+              next += countof rows;
+              sizes[$] = countof rows;
+            },
+            null, 7000) == 60000;
+        assert countof sizes == 9;
+        assert sizes[8] == 4000;
+
+        // The file may be read as a whole, too.
+        var rows = std.csv.parse_file(fname, ["integer"]);
+        assert countof rows == 60000;
+        assert rows[59999][0] == 59999;
+        assert rows[12345][1] == "name #12345\n\"q\"";
+
+        assert catch( std.csv.parse_stream(fname, func(index, row) { }, null, 0) ) != null;
+        assert catch( std.csv.parse_stream(fname, func(index, row) { }, ["real", "real"]) ) != null;
+
+        // Exceptions from the callback are propagated.
+        next = 0;
+        assert catch( std.csv.parse_stream(fname, func(index, row) { if(index == 2) throw "boom"; ++next;  }) ) == "boom";
+        assert next == 2;
+
+        std.filesystem.file_write(fname, "a,\"b\n\nc");
+        assert catch( std.csv.parse_stream(fname, func(index, row) { }) ) != null;
+
+        std.filesystem.file_remove(fname);
+        assert catch( std.csv.parse_stream(fname, func(index, row) { }) ) != null;
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+    code.execute();
+  }
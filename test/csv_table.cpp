@@ -0,0 +1,95 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+using namespace ::asteria;
+
+int main()
+  {
+    Simple_Script code;
+    code.reload_string(
+      sref(__FILE__), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        var t = std.csv.parse_table("id,name,score\r\n1,a,2.5\r\n2,,\r\n3,c,7\r\n,d\r\n",
+                                    ["integer", null, "real"], true);
+        assert t.count() == 4;
+        assert t.names() == ["id", "name", "score"];
+        assert t.column(0) == [1, 2, 3, null];
+        assert t.column("name") == ["a", "", "c", "d"];
+        assert t.column(2) == [2.5, null, 7.0, null];
+
+        var s = t.stats("id");
+        assert s.count == 3;
+        assert s.nulls == 1;
+        assert s.sum == 6;
+        assert s.min == 1;
+        assert s.max == 3;
+        assert s.mean == 2.0;
+
+        s = t.stats(2);
+        assert s.count == 2;
+        assert s.sum == 9.5;
+        assert s.max == 7.0;
+
+        s = t.stats("name");
+        assert s.min == "";
+        assert s.max == "d";
+        assert s.sum == null;
+
+        var f = t.filter("id", 2);
+        assert f.count() == 2;
+        assert f.names() == t.names();
+        assert f.column("score") == [null, 7.0];
+        assert f.filter(2).column(1) == ["c"];
+        assert t.filter(0, 1.5, 2.5).column(0) == [2];
+        assert t.filter(2, null, 5).column(0) == [1];
+        assert t.filter("name", "b", "c").column("id") == [3];
+        assert t.count() == 4;
+
+        assert catch( t.column(3) ) != null;
+        assert catch( t.column("nonexistent") ) != null;
+        assert catch( t.filter("name", 1) ) != null;
+        assert catch( t.filter("id", "1") ) != null;
+        assert catch( std.csv.parse_table("x", ["integer"]) ) != null;
+        assert catch( std.csv.parse_table("1", ["boolean"]) ) != null;
+
+        // no header, extra cells ignored
+        t = std.csv.parse_table("1,2,3\n4", ["integer"]);
+        assert t.names() == null;
+        assert t.column(0) == [1, 4];
+        assert catch( t.column("id") ) != null;
+
+        // many rows, across words of the null bitmap
+        const chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+        // We presume this random string will never match any real files.
+        var fname = ".csv_table-test_file_" + std.string.implode(std.array.shuffle(std.string.explode(chars)));
+        var lines = ["k,v"];
+        for(var i = 0;  i < 1000;  ++i)
+          lines[$] = (i % 7 == 0) ? std.string.format("$1,", i) : std.string.format("$1,$2", i, i * 0.5);
+        std.filesystem.file_write(fname, std.string.implode(lines, "\n"));
+
+        t = std.csv.parse_table_file(fname, ["integer", "real"], true);
+        std.filesystem.file_remove(fname);
+        assert t.count() == 1000;
+        s = t.stats("v");
+        assert s.nulls == 143;
+        assert s.count == 857;
+        var sum = 0;
+        for(var i = 0;  i < 1000;  ++i)
+          if(i % 7 != 0)
+            sum += i * 0.5;
+        assert s.sum == sum;
+
+        f = t.filter("v", 100);
+        assert f.count() == 1000 - 200 - 114;
+        assert f.stats("k").min == 200;
+        assert f.stats("v").nulls == 0;
+        assert std.numeric.sum(f.column("v")) == f.stats("v").sum;
+        assert f.column("v")[std.numeric.max_index(f.column("v"))] == 499.5;
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+    code.execute();
+  }
@@ -72,6 +72,17 @@ int main()
         std.filesystem.file_copy_from(fname + ".2", fname);
         assert std.filesystem.file_read(fname + ".2") == "helHE#??!!";
 
+        // Large files are read in a single batch, and are mapped for hashing
+        // and parsing.
+        var big = "[" + "\"0123456789abcdef\"," * 100000 + "1]";
+        std.filesystem.file_write(fname + ".2", big);
+        assert std.filesystem.file_read(fname + ".2") == big;
+        assert std.filesystem.file_read(fname + ".2", 1000001, 5) == "abcde";
+        assert std.filesystem.file_read(fname + ".2", 1, 1900000) == std.string.slice(big, 1, 1900000);
+        assert std.checksum.crc32_file(fname + ".2") == std.checksum.crc32(big);
+        assert std.checksum.sha256_file(fname + ".2") == std.checksum.sha256(big);
+        assert countof std.json.parse_file(fname + ".2") == 100001;
+
         var data = "";
         var appender = func(off, str) { data += str;  };
         assert catch( std.filesystem.file_stream("/nonexistent", appender) ) != null;
@@ -0,0 +1,52 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+#include "../asteria/runtime/reference.hpp"
+using namespace ::asteria;
+
+// This test checks results of function calls in all PTC modes, with and
+// without proper tail calls.
+
+int main()
+  {
+    static constexpr char s_source[] =
+      R"__(
+        func id(x) { return x;  }
+        func byref(x) { return ->x;  }
+        func nothing() { }
+        func add(a, b) { return a + b;  }
+
+        // non-tail calls
+        var s = 0;
+        for(var i = 0;  i < 3000;  ++i)
+          s = add(s, id(i & 3));
+        assert s == 4500;
+
+        // tail calls by value, by reference and without a value
+        func tail_val(n) { if(n == 0) return 1;  return id(n) - n + tail_val(n - 1);  }
+        func count(n, a) { if(n == 0) return a;  return count(n - 1, a + 1);  }
+        func tail_ref(n) { var x = n;  return byref(x);  }
+        func tail_void(n) { nothing();  return nothing();  }
+        assert tail_val(100) == 1;
+        assert count(100, 0) == 100;
+        assert tail_ref(7) == 7;
+        tail_void(1);
+
+        // variadic calls
+        func vsum(...) { var r = 0;  for(var k = 0;  k < __varg();  ++k) r += __varg(k);  return r;  }
+        func vtail(...) { return __vcall(vsum, [1, 2, 3]);  }
+        assert __vcall(vsum, [4, 5, 6]) == 15;
+        assert vtail() == 6;
+
+        return s;
+      )__";
+
+    for(bool ptc : { false, true }) {
+      Simple_Script code;
+      code.options().proper_tail_calls = ptc;
+      code.reload_string(sref("function_call"), 1, sref(s_source));
+      ASTERIA_TEST_CHECK(code.execute().dereference_readonly().as_integer() == 4500);
+    }
+  }
@@ -40,6 +40,11 @@ int main()
     // Ignore leaks of emutls, emergency pool, etc.
     delete new int;
 
+    // Build the shared `std` object, which lives until the process exits.
+    Global_Context().max_api_version();
+    alloc_list.clear();
+    free_list.clear();
+
     {
       Simple_Script code;
       code.reload_string(
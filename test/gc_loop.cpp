@@ -38,6 +38,8 @@ int main()
     // Ignore leaks of emutls, emergency pool, etc.
     delete new int;
 
+    // Build the shared `std` object, which lives until the process exits.
+    Global_Context().max_api_version();
     bcnt.store(0);
     {
       Simple_Script code;
@@ -0,0 +1,100 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+#include "../asteria/runtime/module_loader.hpp"
+#include "../asteria/runtime/reference.hpp"
+#include "../asteria/compiler/compiler_error.hpp"
+#include <unistd.h>  // ::unlink()
+using namespace ::asteria;
+
+namespace {
+
+void
+do_write_file(const char* path, const char* text)
+  {
+    ::rocket::unique_posix_file fp(::fopen(path, "wb"));
+    ASTERIA_TEST_CHECK(fp);
+    ::fputs(text, fp);
+  }
+
+int64_t
+do_execute(Simple_Script& code)
+  {
+    return code.execute().dereference_readonly().as_integer();
+  }
+
+const Module_Loader::Refresh_Result*
+do_find(const cow_vector<Module_Loader::Refresh_Result>& results, const char* suffix)
+  {
+    for(const auto& r : results)
+      if(r.path.ends_with(sref(suffix)))
+        return &r;
+    return nullptr;
+  }
+
+}  // namespace
+
+int main()
+  {
+    static constexpr char s_main[] = ".hot_reload-test_main.ast";
+    static constexpr char s_module[] = ".hot_reload-test_module.ast";
+
+    do_write_file(s_module, "return 10;");
+    do_write_file(s_main, "return import('.hot_reload-test_module.ast') + 1;");
+
+    Simple_Script code;
+    code.reload_file(s_main);
+    ASTERIA_TEST_CHECK(do_execute(code) == 11);
+    // The function is shared by `code`, `func1` and the module cache.
+    const cow_function func1 = code;
+
+    // Nothing has changed, so compiled code is kept.
+    auto results = code.reload_modified();
+    ASTERIA_TEST_CHECK(results.size() == 2);
+    ASTERIA_TEST_CHECK(do_find(results, s_main)->recompiled == false);
+    ASTERIA_TEST_CHECK(do_find(results, s_module)->recompiled == false);
+    ASTERIA_TEST_CHECK(func1.use_count() == 3);
+    ASTERIA_TEST_CHECK(do_execute(code) == 11);
+
+    // Only the module is recompiled.
+    do_write_file(s_module, "return 200;");
+    results = code.reload_modified();
+    ASTERIA_TEST_CHECK(do_find(results, s_main)->recompiled == false);
+    ASTERIA_TEST_CHECK(do_find(results, s_module)->recompiled == true);
+    ASTERIA_TEST_CHECK(do_find(results, s_module)->compile_seconds >= 0);
+    ASTERIA_TEST_CHECK(func1.use_count() == 3);
+    ASTERIA_TEST_CHECK(do_execute(code) == 201);
+
+    // Only the script is recompiled.
+    do_write_file(s_main, "return import('.hot_reload-test_module.ast') + 3000;");
+    results = code.reload_modified();
+    ASTERIA_TEST_CHECK(do_find(results, s_main)->recompiled == true);
+    ASTERIA_TEST_CHECK(do_find(results, s_module)->recompiled == false);
+    ASTERIA_TEST_CHECK(func1.use_count() == 1);
+    ASTERIA_TEST_CHECK(do_execute(code) == 3200);
+
+    // Errors are reported, and the old code is kept.
+    const cow_function func2 = code;
+    do_write_file(s_main, "return (;");
+    ASTERIA_TEST_CHECK_CATCH(code.reload_modified());
+    ASTERIA_TEST_CHECK(func2.use_count() == 3);
+    ASTERIA_TEST_CHECK(do_execute(code) == 3200);
+
+    // Modules whose files have gone are discarded.
+    do_write_file(s_main, "return 42;");
+    ::unlink(s_module);
+    results = code.reload_modified();
+    ASTERIA_TEST_CHECK(results.size() == 1);
+    ASTERIA_TEST_CHECK(do_find(results, s_main)->recompiled == true);
+    ASTERIA_TEST_CHECK(do_execute(code) == 42);
+
+    // Scripts that are not loaded from files are not checked.
+    code.reload_string(sref("hot_reload"), sref("return 5;"));
+    code.global().module_loader()->clear_cache();
+    ASTERIA_TEST_CHECK(code.reload_modified().size() == 0);
+    ASTERIA_TEST_CHECK(do_execute(code) == 5);
+
+    ::unlink(s_main);
+  }
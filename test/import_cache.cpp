@@ -0,0 +1,63 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+#include "../asteria/runtime/module_loader.hpp"
+using namespace ::asteria;
+
+int main()
+  {
+    Simple_Script code;
+    code.reload_string(
+      sref("import_cache"), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        const chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+        // We presume this random string will never match any real files.
+        var fname = ".import_cache-test_file_" + std.string.implode(std.array.shuffle(std.string.explode(chars)));
+
+        std.filesystem.file_write(fname, "var n = __varg(0);  return n + 1;");
+        assert import(fname, 1) == 2;
+        assert import(fname, 2) == 3;
+
+        // The file is compiled again after it is modified.
+        std.filesystem.file_write(fname, "return __varg(0) * 10;");
+        assert import(fname, 3) == 30;
+        assert import(fname, 4) == 40;
+
+        // Recursion is still detected if the module has been cached.
+        std.filesystem.file_write(fname, "if(__varg(0)) return import(__file, false);  return 7;");
+        assert import(fname, false) == 7;
+        assert catch( import(fname, true) ) != null;
+        assert catch( import(fname, true) ) != null;
+
+        return fname;
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+    auto fname = code.execute().dereference_readonly().as_string();
+    auto loader = code.global().module_loader();
+    ASTERIA_TEST_CHECK(loader->cache_size() == 1);
+
+    // Invalidation
+    ASTERIA_TEST_CHECK(loader->invalidate(fname.c_str()) == true);
+    ASTERIA_TEST_CHECK(loader->invalidate(fname.c_str()) == false);
+    ASTERIA_TEST_CHECK(loader->cache_size() == 0);
+
+    // The cache can be disabled.
+    code.reload_string(
+      sref("import_cache"), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        assert import(__varg(0), false) == 7;
+        std.filesystem.file_remove(__varg(0));
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+    loader->set_cache_enabled(false);
+    cow_vector<Value> args;
+    args.emplace_back(fname);
+    code.execute(::std::move(args));
+    ASTERIA_TEST_CHECK(loader->cache_size() == 0);
+  }
@@ -0,0 +1,68 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+#include "../rocket/unique_posix_file.hpp"
+using namespace ::asteria;
+
+int main()
+  {
+    // Redirect standard input from a file.
+    static constexpr char fname[] = ".io_getln-test_file";
+    ::rocket::unique_posix_file fp(::fopen(fname, "wb"));
+    ASTERIA_TEST_CHECK(fp);
+    ::fputs("hello\n\xE4\xB8\xAD\xE6\x96\x87\n\nx\ny\n", fp);
+    for(size_t k = 0;  k != 100000;  ++k)
+      ::fputc('a' + (int) (k % 26), fp);
+    ::fputs("\n\xCE\xB1\xF0\x9F\x98\x80ok\nlast", fp);
+    fp.reset();
+    ASTERIA_TEST_CHECK(::freopen(fname, "rb", stdin) == stdin);
+
+    Simple_Script code;
+    code.reload_string(
+      sref(__FILE__), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        assert std.io.getln() == "hello";
+        assert std.io.getc() == 0x4E2D;
+        assert std.io.getln() == "文";
+        assert std.io.getlns(2) == ["", "x"];
+        assert catch( std.io.getlns(0) ) != null;
+        assert std.io.getlns(1) == ["y"];
+        var long = std.io.getln();
+        assert countof long == 100000;
+        assert std.string.slice(long, 99990) == "uvwxyzabcd";
+        assert std.io.getc() == 0x03B1;
+        assert std.io.getc() == 0x1F600;
+        assert std.io.getlns() == ["ok", "last"];
+        assert std.io.getln() == null;
+        assert std.io.getlns() == null;
+        assert std.io.getc() == null;
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+    code.execute();
+
+    // Invalid UTF-8 strings are rejected.
+    fp.reset(::fopen(fname, "wb"));
+    ASTERIA_TEST_CHECK(fp);
+    ::fputs("ok\nbad\xFF\n\xC0\x80\n\xE4\xB8", fp);
+    fp.reset();
+    ASTERIA_TEST_CHECK(::freopen(fname, "rb", stdin) == stdin);
+
+    code.reload_string(
+      sref(__FILE__), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        assert std.io.getln() == "ok";
+        assert catch( std.io.getln() ) != null;
+        assert catch( std.io.getc() ) != null;
+        assert std.io.getln() == "";
+        assert catch( std.io.getc() ) != null;
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+    code.execute();
+    ::unlink(fname);
+  }
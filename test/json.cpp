@@ -103,6 +103,43 @@ int main()
         assert countof r[1].c == 0;
         assert r[1].d == 4;
 
+        // extensions
+        assert std.json.parse("/* a */ [1, // b\n 2 /* c\n d */, 3,]") == [1,2,3];
+        assert std.json.parse("[0b1010, 0x1F, 0x1p4, 1`000, +5, -2.5e1]") == [10,31,16,1000,5,-25];
+        assert std.json.parse("[-Infinity, infinity]") == [-infinity,infinity];
+        assert __isnan std.json.parse("-nan");
+        assert std.json.parse("'a\\x41\\u55B5\\U01F600\\'\"'") == "aA喵😀'\"";
+        assert std.json.parse("\"\\a\\v\\0\\Z\\e\\?\\/\"") == "\a\v\0\x1A\x1B?/";
+        assert std.json.parse("\xEF\xBB\xBF  {'k': \"v\", _9: [ ], \"\\u0041\": {}}").k == "v";
+        assert std.json.parse("{nan:1}")["nan"] == 1;
+        assert std.json.parse("{a:{b:{c:[true,false,null]}}}").a.b.c == [true,false,null];
+
+        var long = "x" * 1000 + "\\n" + "y" * 100;
+        assert std.json.parse("\"" + long + "\"") == "x" * 1000 + "\n" + "y" * 100;
+        assert std.json.parse(" " * 1000 + "1" + "\n" * 1000) == 1;
+
+        // errors
+        assert catch( std.json.parse("  ") ) != null;
+        assert catch( std.json.parse("/* */") ) != null;
+        assert catch( std.json.parse("/* ") ) != null;
+        assert catch( std.json.parse("[1,,2]") ) != null;
+        assert catch( std.json.parse("[1 2]") ) != null;
+        assert catch( std.json.parse("{a 1}") ) != null;
+        assert catch( std.json.parse("{a:1,a:2}") ) != null;
+        assert catch( std.json.parse("{1:2}") ) != null;
+        assert catch( std.json.parse("[1]]") ) != null;
+        assert catch( std.json.parse("\"abc") ) != null;
+        assert catch( std.json.parse("\"ab\nc\"") ) != null;
+        assert catch( std.json.parse("\"\\q\"") ) != null;
+        assert catch( std.json.parse("\"\\x4\"") ) != null;
+        assert catch( std.json.parse("\"\\uD800\"") ) != null;
+        assert catch( std.json.parse("12abc") ) != null;
+        assert catch( std.json.parse("1e999") ) != null;
+        assert catch( std.json.parse("nul") ) != null;
+        assert catch( std.json.parse("- 1") ) != null;
+        assert catch( std.json.parse("\"\xFF\"") ) != null;
+        assert catch( std.json.parse("[1,\0]") ) != null;
+
         const depth = 1000;
         var r = [];
         for(var i = 1; i < depth; ++i) {
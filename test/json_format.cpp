@@ -0,0 +1,100 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/library/json.hpp"
+#include "../asteria/library/filesystem.hpp"
+#include "../asteria/value.hpp"
+#include "../asteria/utils.hpp"
+using namespace ::asteria;
+
+// This test compares quoting of strings against a naive implementation, with
+// characters that need escaping placed across block boundaries, and checks
+// that formatting to a file yields the same text as formatting to a string.
+
+namespace {
+
+cow_string
+do_naive_quote(const cow_string& str)
+  {
+    cow_string text = sref("\"");
+    size_t offset = 0;
+    while(offset < str.size()) {
+      char32_t cp;
+      if(!utf8_decode(cp, str, offset)) {
+        cp = 0xFFFD;
+        offset ++;
+      }
+
+      if((cp == '\"') || (cp == '\\'))
+        text.append({ '\\', static_cast<char>(cp) });
+      else if((cp >= 0x20) && (cp <= 0x7E))
+        text.push_back(static_cast<char>(cp));
+      else if((cp != 0) && (cp < 0x20) && ::strchr("\b\f\n\r\t", static_cast<int>(cp)))
+        text.append({ '\\', "btn?fr"[::strchr("\b\t\n\v\f\r", static_cast<int>(cp)) - "\b\t\n\v\f\r"] });
+      else {
+        char16_t ustr[2];
+        char16_t* epos = ustr;
+        utf16_encode(epos, cp);
+        for(auto p = ustr;  p != epos;  ++p) {
+          char seq[8];
+          ::sprintf(seq, "\\u%.4X", static_cast<unsigned>(*p));
+          text.append(seq);
+        }
+      }
+    }
+    text.push_back('\"');
+    return text;
+  }
+
+}  // namespace
+
+int main()
+  {
+    // These characters need escaping, or are just around those.
+    static constexpr char s_specials[][5] =
+      {
+        "\"", "\\", "\x01", "\b", "\n", "\x1F", " ", "~", "\x7F", "\xC2\xA9",
+        "\xE4\xB8\xAD", "\xF0\x9F\x98\x80", "\xFF", "\xE4\xB8",
+      };
+
+    // As there are thousands of cases, only failures are logged.
+    size_t nfailed = 0;
+    for(const char* special : s_specials)
+      for(size_t pos = 0;  pos != 40;  ++pos)
+        for(size_t size : { 0U, 1U, 15U, 16U, 17U, 31U, 32U, 33U }) {
+          cow_string str(pos + size, 'a');
+          str.insert(pos, special);
+          cow_string expect = do_naive_quote(str);
+          V_string text = std_json_format(str, nullopt, nullopt);
+          if(text != expect) {
+            ::fprintf(stderr, "std_json_format() mismatch: %s\n", text.c_str());
+            nfailed ++;
+          }
+        }
+    ASTERIA_TEST_CHECK(nfailed == 0);
+
+    // Make a value which is larger than a block.
+    V_array array;
+    for(int64_t k = 0;  k != 20000;  ++k) {
+      V_object object;
+      object.try_emplace(sref("id"), k);
+      object.try_emplace(sref("name"), cow_string(static_cast<size_t>(k % 50), 'x') + "\t\xE5\x96\xB5");
+      object.try_emplace(sref("score"), static_cast<double>(k) / 7);
+      object.try_emplace(sref("tags"), V_array{ true, nullopt, sref("a\"b") });
+      array.emplace_back(::std::move(object));
+    }
+    const Value value = ::std::move(array);
+
+    cow_string fname = sref(".json_format-test_file_");
+    fname.append(__TIME__);
+    for(const auto& indent : { optV_string(), optV_string(sref("\t")) }) {
+      V_string text = std_json_format(value, indent, true);
+      ASTERIA_TEST_CHECK(std_json_parse(text).as_array().size() == 20000);
+      ASTERIA_TEST_CHECK(std_json_format_file(fname, value, indent, true) == (int64_t) text.size());
+      ASTERIA_TEST_CHECK(std_filesystem_file_read(fname, nullopt, nullopt) == text);
+    }
+    ASTERIA_TEST_CHECK(std_json_format_file(fname, value, 4, nullopt) == (int64_t) std_json_format(value, 4, nullopt).size());
+    ::unlink(fname.c_str());
+    ASTERIA_TEST_CHECK_CATCH(std_json_format_file(sref("/nonexistent/dir/file"), value, nullopt, nullopt));
+  }
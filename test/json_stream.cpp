@@ -0,0 +1,92 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+using namespace ::asteria;
+
+int main()
+  {
+    Simple_Script code;
+    code.reload_string(
+      sref(__FILE__), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        const chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+        // We presume this random string will never match any real files.
+        var fname = ".json_stream-test_file_" + std.string.implode(std.array.shuffle(std.string.explode(chars)));
+
+        // NDJSON, which spans multiple blocks
+        var lines = [];
+        for(var i = 0;  i < 40000;  ++i)
+          lines[$] = std.json.format({ id: i, name: "record #" + std.string.format("$1", i), tags: [1,2,3] });
+        std.filesystem.file_write(fname, std.string.implode(lines, "\n") + "\n\n");
+
+        var sum = 0;
+        var next = 0;
+        assert std.json.parse_stream(fname,
+            func(index, value) {
+              assert index == next++;
+              assert value.id == index;
+              assert value.tags == [1,2,3];
+              sum += value.id;
+            }) == 40000;
+        assert sum == 40000 * 39999 / 2;
+
+        // a sequence of values of all types, with comments
+        std.filesystem.file_write(fname, "\xEF\xBB\xBF 1 /* a */ true\nnull 'x' // b\n[2,] {c:3}");
+        var values = [];
+        assert std.json.parse_stream(fname, func(index, value) { values[$] = value;  }) == 6;
+        assert values[0] == 1;
+        assert values[1] == true;
+        assert values[2] == null;
+        assert values[3] == "x";
+        assert values[4] == [2];
+        assert values[5].c == 3;
+
+        // elements of nested arrays, where some values are larger than a block
+        var big = "y" * 3000000;
+        std.filesystem.file_write(fname,
+            "{ \"skip\": [\"" + big + "\", {\"data\": []}], // comment\n" +
+            "  meta: { data: 1 },\n" +
+            "  'data': { \"items\": [ \"" + big + "\", {\"k\": [1, 2]}, 3, ], \"z\": 0 } }");
+
+        values = [];
+        assert std.json.parse_stream(fname, func(index, value) { values[$] = value;  }, ["data", "items"]) == 3;
+        assert values[0] == big;
+        assert values[1].k == [1,2];
+        assert values[2] == 3;
+
+        assert std.json.parse_stream(fname, func(index, value) { values[$] = value;  }, ["skip"]) == 2;
+        assert catch( std.json.parse_stream(fname, func(index, value) { }, ["nonexistent"]) ) != null;
+        assert catch( std.json.parse_stream(fname, func(index, value) { }, ["meta", "data"]) ) != null;
+        assert catch( std.json.parse_stream(fname, func(index, value) { }, ["data"]) ) != null;
+
+        std.filesystem.file_write(fname, "[]");
+        assert std.json.parse_stream(fname, func(index, value) { assert false;  }, []) == 0;
+
+        // errors
+        std.filesystem.file_write(fname, "[1, 2 3]");
+        assert catch( std.json.parse_stream(fname, func(index, value) { }, []) ) != null;
+        std.filesystem.file_write(fname, "1\n{a:\n");
+        assert catch( std.json.parse_stream(fname, func(index, value) { }) ) != null;
+        std.filesystem.file_write(fname, "1\n'abc\n");
+        assert catch( std.json.parse_stream(fname, func(index, value) { }) ) != null;
+        std.filesystem.file_write(fname, "1 /* 2");
+        assert catch( std.json.parse_stream(fname, func(index, value) { }) ) != null;
+        std.filesystem.file_write(fname, "1 \xFF");
+        assert catch( std.json.parse_stream(fname, func(index, value) { }) ) != null;
+
+        // Exceptions from the callback are propagated.
+        std.filesystem.file_write(fname, "1 2 3");
+        next = 0;
+        assert catch( std.json.parse_stream(fname, func(index, value) { if(value == 2) throw "boom"; ++next;  }) ) == "boom";
+        assert next == 1;
+
+        std.filesystem.file_remove(fname);
+        assert catch( std.json.parse_stream(fname, func(index, value) { }) ) != null;
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+    code.execute();
+  }
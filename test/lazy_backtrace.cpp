@@ -0,0 +1,84 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+#include "../asteria/runtime/runtime_error.hpp"
+using namespace ::asteria;
+
+// This test checks backtraces and messages of exceptions, which are built
+// only when they are requested.
+
+int main()
+  {
+    Simple_Script code;
+    code.reload_string(
+      sref(__FILE__), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        func check(x) {
+          if(x < 0)
+            throw "negative";
+          return x;
+        }
+
+        // The backtrace is still available after another exception has been
+        // thrown and caught inside the `catch` clause.
+        try
+          check(-1);
+        catch(e) {
+          assert e == "negative";
+          try
+            check(-2);
+          catch(e2)
+            assert __backtrace[0].frame == "throw statement";
+
+          var bt = __backtrace;
+          assert bt[0].frame == "throw statement";
+          assert bt[0].value == "negative";
+          assert bt[0].line == 21;
+          assert bt[$].frame == "  try clause";
+        }
+
+        // `__backtrace` can be captured by closures.
+        var f;
+        try
+          check(-3);
+        catch(e)
+          f = func() { return __backtrace;  };
+        assert f()[0].value == "negative";
+
+        // Validation in a loop.
+        var count = 0;
+        for(var i = 0;  i < 200;  ++i)
+          try
+            check(i % 2 - 1);
+          catch(e)
+            ++count;
+        assert count == 100;
+
+        // This exception is not caught.
+        check(-42);
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+
+    try {
+      code.execute();
+      ASTERIA_TEST_CHECK(false);
+    }
+    catch(Runtime_Error& except) {
+      ASTERIA_TEST_CHECK(except.value().as_string() == sref("negative"));
+      ASTERIA_TEST_CHECK(except.count_frames() >= 3);
+
+      // The message is built on demand, and rebuilt after a new frame.
+      cow_string msg = sref(except.what());
+      ASTERIA_TEST_CHECK(msg.find("runtime error: negative") == 0);
+      ASTERIA_TEST_CHECK(msg.find("[backtrace frames:") != cow_string::npos);
+      ASTERIA_TEST_CHECK(msg.find("test remark") == cow_string::npos);
+
+      except.push_frame_plain(except.frame(0).sloc(), sref("test remark"));
+      msg = sref(except.what());
+      ASTERIA_TEST_CHECK(msg.find("test remark") != cow_string::npos);
+    }
+  }
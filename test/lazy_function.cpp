@@ -0,0 +1,52 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+using namespace ::asteria;
+
+int main()
+  {
+    Simple_Script code;
+    code.reload_string(
+      sref(__FILE__), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        var c0 = std.system.count_functions();
+
+        // Functions are not compiled until called.
+        var funcs = [];
+        for(var i = 0;  i < 100;  ++i)
+          funcs[$] = func(x) { return x * 2 + 3;  };
+
+        var c1 = std.system.count_functions();
+        assert c1.instantiated - c0.instantiated == 100;
+        assert c1.compiled - c0.compiled == 0;
+
+        assert funcs[3](10) == 23;
+        assert funcs[3](20) == 43;
+        assert funcs[7](1) == 5;
+
+        var c2 = std.system.count_functions();
+        assert c2.instantiated - c1.instantiated == 0;
+        assert c2.compiled - c1.compiled == 2;
+        assert c2.uncompiled == c2.instantiated - c2.compiled;
+
+        // Closures keep their captured variables alive before they are compiled.
+        func make(n) {
+          var s = std.string.format("v$1", n);
+          return func() { return s;  };
+        }
+        var g = make(42);
+        std.system.gc_collect();
+        assert g() == "v42";
+
+        // Errors in bodies are only seen when called.
+        func bad() { throw "oops";  }
+        assert catch( bad() ) == "oops";
+        assert catch( bad() ) == "oops";
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+    code.execute();
+  }
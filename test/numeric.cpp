@@ -3,6 +3,7 @@
 
 #include "utils.hpp"
 #include "../asteria/simple_script.hpp"
+#include "../asteria/utils.hpp"
 using namespace ::asteria;
 
 int main()
@@ -105,6 +106,71 @@ int main()
         assert std.numeric.min(1, 1.5, 2, null, 0.5) == 0.5;
         assert std.numeric.min(1, 1.5, 2, 0.5, null) == 0.5;
 
+        assert std.numeric.sum([]) == 0;
+        assert typeof std.numeric.sum([]) == "integer";
+        assert std.numeric.sum([1,2,3,4,5,6,7,8,9,10,11]) == 66;
+        assert typeof std.numeric.sum([1,2,3,4,5,6,7,8,9,10,11]) == "integer";
+        assert std.numeric.sum([1,2,3,4,5,6,7,8,9,10,11.5]) == 66.5;
+        assert typeof std.numeric.sum([1,2,3,4,5,6,7,8,9,10,11.5]) == "real";
+        assert catch( std.numeric.sum([0x7FFFFFFFFFFFFFFF,1,2,3,-1,-2,-3,-4]) ) != null;
+        assert std.numeric.sum([0x7FFFFFFFFFFFFFFF,-1,-2,-3,1,2,3,-4]) == 0x7FFFFFFFFFFFFFFB;
+        assert std.numeric.sum([-0x7FFFFFFFFFFFFFFF,-1,1,2,3,4,5,6,7]) == -0x7FFFFFFFFFFFFFFF + 27;
+        assert std.numeric.sum([1,2,3,4,5,6,7,8,-0x7FFFFFFFFFFFFFFF-1]) == -0x7FFFFFFFFFFFFFFF + 35;
+        assert catch( std.numeric.sum([-1,-0x7FFFFFFFFFFFFFFF-1,2,3,4,5,6,7,8]) ) != null;
+        assert catch( std.numeric.sum([0x7FFFFFFFFFFFFFFF,1,2,3,4,5,6,7]) ) != null;
+        assert catch( std.numeric.sum([1,2,"3"]) ) != null;
+        assert std.numeric.sum([1,2,infinity,4,5,6,7,8]) == infinity;
+        assert __isnan std.numeric.sum([1,2,infinity,4,5,-infinity,7,8]);
+        assert __isnan std.numeric.sum([1,2,3,4,5,6,7,nan,9]);
+
+        assert std.numeric.product([]) == 1;
+        assert std.numeric.product([1,2,3,4,5,6,7,8,9]) == 362880;
+        assert typeof std.numeric.product([1,2,3,4,5,6,7,8,9]) == "integer";
+        assert std.numeric.product([1,2,3,4,5,6,7,8,0.5]) == 20160.0;
+        assert catch( std.numeric.product([0x100000000,0x100000000]) ) != null;
+
+        assert std.numeric.mean([]) == null;
+        assert std.numeric.mean([1,2,3,4,5,6,7,8,9]) == 5.0;
+        assert std.numeric.mean([0x7FFFFFFFFFFFFFFF,0x7FFFFFFFFFFFFFFF]) == 0x1.0p63;
+        assert std.numeric.mean([1.5,2.5]) == 2.0;
+
+        assert std.numeric.max_index([]) == null;
+        assert std.numeric.max_index([5]) == 0;
+        assert std.numeric.max_index([3,1,4,1,5,9,2,6,5,3,5,9,7]) == 5;
+        assert std.numeric.max_index([3,1,4,1,5,9,2,6,5,3,5,9.5,7]) == 11;
+        assert std.numeric.max_index([nan]) == 0;
+        assert catch( std.numeric.max_index([3,1,4,1,5,9,2,6,nan,3,5,9.5,7]) ) != null;
+        assert std.numeric.min_index([3,1,4,1,5,9,2,6,5,3,5,9,7]) == 1;
+        assert std.numeric.min_index([3,1,4,1,5,9,2,6,5,3,5,9,-7]) == 12;
+        assert std.numeric.min_index([3,1,4,1,5,9,2,6,5,3,5,9,0.5]) == 12;
+        assert std.numeric.min_index([0.0,-0.0,1,2,3,4,5,6,7]) == 0;
+        assert catch( std.numeric.min_index([3,nan]) ) != null;
+
+        assert std.numeric.dot([], []) == 0;
+        assert std.numeric.dot([1,2,3,4,5], [6,7,8,9,10]) == 130;
+        assert typeof std.numeric.dot([1,2,3,4,5], [6,7,8,9,10]) == "integer";
+        assert std.numeric.dot([1,2,3,4,5], [6,7,8,9,0.5]) == 82.5;
+        assert catch( std.numeric.dot([1,2], [1]) ) != null;
+        assert catch( std.numeric.dot([0x100000000], [0x100000000]) ) != null;
+
+        assert std.numeric.axpy(2, [1,2,3,4,5], [10,20,30,40,50]) == [12,24,36,48,60];
+        assert std.numeric.axpy(0.5, [1,2,3,4,5], [10,20,30,40,50]) == [10.5,21.0,31.5,42.0,52.5];
+        assert std.numeric.axpy(2, [1,2,3,4,5], [10,20,30,40,0.5]) == [12.0,24.0,36.0,48.0,10.5];
+        assert catch( std.numeric.axpy(2, [0x7FFFFFFFFFFFFFFF], [0]) ) != null;
+
+        assert std.numeric.add_each([1,2,3,4,5], [10,20,30,40,50]) == [11,22,33,44,55];
+        assert std.numeric.add_each([1,2,3,4,5], [10,20,30,40,0.5]) == [11.0,22.0,33.0,44.0,5.5];
+        assert catch( std.numeric.add_each([1,2,3,4,0x7FFFFFFFFFFFFFFF], [1,2,3,4,5]) ) != null;
+        assert catch( std.numeric.add_each([1,2,3,4], [1,2,3]) ) != null;
+        assert std.numeric.mul_each([1,2,3,4,5], [10,20,30,40,50]) == [10,40,90,160,250];
+        assert std.numeric.mul_each([1,2,3,4,5], [10,20,30,40,0.5]) == [10.0,40.0,90.0,160.0,2.5];
+        assert catch( std.numeric.mul_each([0x100000000], [0x100000000]) ) != null;
+
+        assert std.numeric.prefix_sum([]) == [];
+        assert std.numeric.prefix_sum([1,2,3,4,5]) == [1,3,6,10,15];
+        assert std.numeric.prefix_sum([1,2,3,4,0.5]) == [1.0,3.0,6.0,10.0,10.5];
+        assert catch( std.numeric.prefix_sum([0x7FFFFFFFFFFFFFFF,1,-1]) ) != null;
+
         assert std.numeric.clamp(1, 2, 3) == 2;
         assert std.numeric.clamp(2, 2, 3) == 2;
         assert std.numeric.clamp(3, 2, 3) == 3;
@@ -464,5 +530,10 @@ int main()
 
 ///////////////////////////////////////////////////////////////////////////////
       )__"));
-    code.execute();
+
+    // Fallback paths shall produce the same results.
+    for(auto level : { cpu_features_all, cpu_features_ssse3, cpu_features_sse2 }) {
+      limit_cpu_features(level);
+      code.execute();
+    }
   }
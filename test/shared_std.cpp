@@ -0,0 +1,48 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+#include "../asteria/runtime/global_context.hpp"
+#include "../asteria/runtime/variable.hpp"
+using namespace ::asteria;
+
+// This test checks that the `std` object is shared by global contexts.
+
+int main()
+  {
+    Global_Context first;
+    Global_Context second;
+    const auto& ostd = first.std_variable()->get_value().as_object();
+    ASTERIA_TEST_CHECK(ostd.use_count() >= 2);
+    ASTERIA_TEST_CHECK(ostd.size() > 10);
+
+    const auto& ostd2 = second.std_variable()->get_value().as_object();
+    ASTERIA_TEST_CHECK(ostd2.use_count() == ostd.use_count());
+    ASTERIA_TEST_CHECK(ostd2.at(sref("string")).as_object().at(sref("format")).as_function().use_count()
+                       == ostd.at(sref("string")).as_object().at(sref("format")).as_function().use_count());
+
+    // A different API version gets a different object.
+    Global_Context old(api_version_none);
+    const auto& ostd_old = old.std_variable()->get_value().as_object();
+    ASTERIA_TEST_CHECK(ostd_old.size() == 1);
+    ASTERIA_TEST_CHECK(ostd_old.at(sref("version")).as_object().at(sref("major")).as_integer() == 0);
+
+    // Copies are never modified by scripts.
+    Simple_Script code;
+    code.reload_string(
+      sref(__FILE__), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        var s = std.string;
+        s.format = 42;
+        s.meow = "meow";
+        assert std.string.format != 42;
+        assert std.string.meow == null;
+        assert catch(std.string.meow = 1) != null;
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+    code.execute();
+    ASTERIA_TEST_CHECK(ostd.at(sref("string")).as_object().count(sref("meow")) == 0);
+  }
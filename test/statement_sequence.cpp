@@ -36,7 +36,7 @@ int main()
       )__"), tinybuf::open_read);
 
     Token_Stream tstrm({ });
-    tstrm.reload(sref("dummy file"), 16, ::std::move(cbuf));
+    tstrm.reload(sref("dummy file"), 16, cbuf);
 
     Statement_Sequence stmtq({ });
     stmtq.reload(::std::move(tstrm));
@@ -3,6 +3,7 @@
 
 #include "utils.hpp"
 #include "../asteria/simple_script.hpp"
+#include "../asteria/utils.hpp"
 using namespace ::asteria;
 
 int main()
@@ -355,6 +356,25 @@ int main()
         assert m.yy == null;
         assert m.zz == "2c";
 
+        var M_jit = std.string.PCRE('(\w)(\d+)', [ "jit", "caseless" ]);
+        assert M_jit.match("A11B2") == [ "A11", "A", "11" ];
+        assert M_jit.replace("a11b2c333", '$2$1') == "11a2b333c";
+        assert catch( std.string.PCRE('x', [ "nonexistent" ]) ) != null;
+
+        std.string.pcre_cache_clear();
+        var s1 = std.string.pcre_cache_stats();
+        assert s1.size == 0;
+        assert s1.capacity > 0;
+        assert std.string.pcre_match("abcABC", 'b', [ "caseless" ]) == [ "b" ];
+        assert std.string.pcre_match("ABCabc", 'b', [ "caseless" ]) == [ "B" ];
+        assert std.string.pcre_match("ABCabc", 'b') == [ "b" ];
+        var s2 = std.string.pcre_cache_stats();
+        assert s2.size == 2;
+        assert s2.hits == s1.hits + 1;
+        assert s2.misses == s1.misses + 2;
+        std.string.pcre_cache_clear();
+        assert std.string.pcre_cache_stats().size == 0;
+
         assert std.string.iconv("UTF-16", "") == "";
         assert catch( std.string.iconv("invalid encoding", "") ) != null;
         assert catch( std.string.iconv("UTF-8", "", "invalid encoding") ) != null;
@@ -365,5 +385,10 @@ int main()
 
 ///////////////////////////////////////////////////////////////////////////////
       )__"));
-    code.execute();
+
+    // Fallback paths shall produce the same results.
+    for(auto level : { cpu_features_all, cpu_features_ssse3, cpu_features_sse2 }) {
+      limit_cpu_features(level);
+      code.execute();
+    }
   }
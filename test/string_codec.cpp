@@ -0,0 +1,137 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/library/string.hpp"
+#include "../asteria/utils.hpp"
+using namespace ::asteria;
+
+// This test compares encoders and decoders against naive implementations,
+// over data of various lengths, so all block sizes and tails are covered.
+
+namespace {
+
+cow_string
+do_make_data(size_t size, uint32_t seed)
+  {
+    cow_string data;
+    for(size_t k = 0;  k != size;  ++k) {
+      seed = seed * 1103515245U + 12345U;
+      data.push_back(static_cast<char>(seed >> 16));
+    }
+    return data;
+  }
+
+cow_string
+do_naive_hex(const cow_string& data)
+  {
+    cow_string text;
+    for(char c : data) {
+      text.push_back("0123456789ABCDEF"[uint8_t(c) >> 4]);
+      text.push_back("0123456789ABCDEF"[uint8_t(c) & 15]);
+    }
+    return text;
+  }
+
+cow_string
+do_naive_base64(const cow_string& data)
+  {
+    static constexpr char s_digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    cow_string text;
+    for(size_t k = 0;  k < data.size();  k += 3) {
+      uint32_t reg = uint32_t(uint8_t(data[k])) << 16;
+      if(k + 1 < data.size())
+        reg |= uint32_t(uint8_t(data[k + 1])) << 8;
+      if(k + 2 < data.size())
+        reg |= uint32_t(uint8_t(data[k + 2]));
+
+      text.push_back(s_digits[reg >> 18 & 63]);
+      text.push_back(s_digits[reg >> 12 & 63]);
+      text.push_back((k + 1 < data.size()) ? s_digits[reg >> 6 & 63] : '=');
+      text.push_back((k + 2 < data.size()) ? s_digits[reg & 63] : '=');
+    }
+    return text;
+  }
+
+cow_string
+do_naive_url(const cow_string& data, bool query)
+  {
+    cow_string text;
+    for(char c : data)
+      if(::isalnum(uint8_t(c)) || (c == '-') || (c == '_') || (c == '.') || (!query && (c == '~')))
+        text.push_back(c);
+      else if(query && (c == ' '))
+        text.push_back('+');
+      else {
+        text.push_back('%');
+        text.push_back("0123456789ABCDEF"[uint8_t(c) >> 4]);
+        text.push_back("0123456789ABCDEF"[uint8_t(c) & 15]);
+      }
+    return text;
+  }
+
+void
+do_check_all()
+  {
+    for(size_t size = 0;  size != 200;  ++size) {
+      const cow_string data = do_make_data(size, static_cast<uint32_t>(size));
+
+      cow_string text = std_string_hex_encode(data, nullopt);
+      ASTERIA_TEST_CHECK(text == do_naive_hex(data));
+      ASTERIA_TEST_CHECK(std_string_hex_decode(text) == data);
+      for(size_t k = 0;  k != text.size();  ++k)
+        text.mut(k) = static_cast<char>(::tolower(text[k]));
+      ASTERIA_TEST_CHECK(std_string_hex_decode(text) == data);
+
+      text = std_string_base64_encode(data);
+      ASTERIA_TEST_CHECK(text == do_naive_base64(data));
+      ASTERIA_TEST_CHECK(std_string_base64_decode(text) == data);
+
+      text = std_string_base32_encode(data);
+      ASTERIA_TEST_CHECK(std_string_base32_decode(text) == data);
+
+      text = std_string_url_encode(data);
+      ASTERIA_TEST_CHECK(text == do_naive_url(data, false));
+      ASTERIA_TEST_CHECK(std_string_url_decode(text) == data);
+
+      text = std_string_url_query_encode(data);
+      ASTERIA_TEST_CHECK(text == do_naive_url(data, true));
+      ASTERIA_TEST_CHECK(std_string_url_query_decode(text) == data);
+    }
+
+    // Spaces may only occur between groups.
+    const cow_string data = do_make_data(3000, 42);
+    cow_string text = std_string_base64_encode(data);
+    for(size_t k = 76;  k < text.size();  k += 77)
+      text.insert(k, 1, '\n');
+    ASTERIA_TEST_CHECK(std_string_base64_decode(text) == data);
+
+    text = std_string_hex_encode(data, sref(" "));
+    ASTERIA_TEST_CHECK(std_string_hex_decode(text) == data);
+
+    // Invalid characters shall be reported wherever they are.
+    for(size_t pos : { 0U, 1U, 15U, 16U, 31U, 32U, 63U, 64U, 100U, 3999U }) {
+      text = std_string_base64_encode(data);
+      text.mut(pos) = '*';
+      ASTERIA_TEST_CHECK_CATCH(std_string_base64_decode(text));
+
+      text = std_string_hex_encode(data, nullopt);
+      text.mut(pos) = 'g';
+      ASTERIA_TEST_CHECK_CATCH(std_string_hex_decode(text));
+
+      text = std_string_url_encode(data);
+      text.mut(pos) = '\x7F';
+      ASTERIA_TEST_CHECK_CATCH(std_string_url_decode(text));
+    }
+  }
+
+}  // namespace
+
+int main()
+  {
+    // Fallback paths shall produce the same results.
+    for(auto level : { cpu_features_all, cpu_features_ssse3, cpu_features_sse2 }) {
+      limit_cpu_features(level);
+      do_check_all();
+    }
+  }
@@ -0,0 +1,152 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/library/string.hpp"
+#include "../asteria/utils.hpp"
+using namespace ::asteria;
+
+// This test compares substring search and character class scanning against
+// naive implementations, over texts of typical sizes.
+
+namespace {
+
+cow_string
+do_make_text(size_t size, uint32_t seed)
+  {
+    static constexpr char s_words[][12] =
+      {
+        "the", "quick", "brown", "fox", "jumps", "over", "lazy", "dog",
+        "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "\t", "\n",
+        "0123", "{\"k\":", "\xE4\xB8\xAD", "\xFF\xFE", "a", "aa", "aaa", "ab",
+      };
+
+    cow_string text;
+    text.reserve(size);
+    while(text.size() < size) {
+      seed = seed * 1103515245U + 12345U;
+      text.append(s_words[(seed >> 16) % (sizeof(s_words) / sizeof(*s_words))]);
+      text.push_back(' ');
+    }
+    text.erase(size);
+    return text;
+  }
+
+size_t
+do_naive_find(const cow_string& text, size_t from, const char* patt)
+  {
+    size_t plen = ::strlen(patt);
+    for(size_t k = from;  k + plen <= text.size();  ++k)
+      if(::memcmp(text.data() + k, patt, plen) == 0)
+        return k;
+    return cow_string::npos;
+  }
+
+size_t
+do_naive_rfind(const cow_string& text, size_t to, const char* patt)
+  {
+    size_t plen = ::strlen(patt);
+    if(text.size() < plen)
+      return cow_string::npos;
+    for(size_t k = ::std::min(to, text.size() - plen);  k != SIZE_MAX;  --k)
+      if(::memcmp(text.data() + k, patt, plen) == 0)
+        return k;
+    return cow_string::npos;
+  }
+
+size_t
+do_naive_find_of(const cow_string& text, const char* set, bool match, bool rev)
+  {
+    size_t result = cow_string::npos;
+    for(size_t k = 0;  k != text.size();  ++k)
+      if((::memchr(set, text[k], ::strlen(set)) != nullptr) == match) {
+        result = k;
+        if(!rev)
+          break;
+      }
+    return result;
+  }
+
+void
+do_check_all()
+  {
+    static constexpr char s_patterns[][16] =
+      {
+        "a", "ab", "fox", "dog ", "consectetur", "\xE4\xB8\xAD", "aaaa", "zzz",
+        "amet \n", "lazy dog lazy", "\xFF\xFE \t",
+      };
+
+    static constexpr char s_sets[][12] =
+      {
+        " ", " \t\n", "aeiou", "0123456789", "\xE4\xFF", "{}:\"", "xyz", "#%&",
+      };
+
+    for(size_t size : { 0U, 1U, 15U, 33U, 1024U, 65536U, 1048576U }) {
+      const cow_string text = do_make_text(size, static_cast<uint32_t>(size));
+
+      // Substring search
+      for(const char* patt : s_patterns) {
+        size_t expect = do_naive_find(text, 0, patt);
+        optV_integer r = std_string_find(text, 0, nullopt, sref(patt));
+        ASTERIA_TEST_CHECK((r ? static_cast<size_t>(*r) : cow_string::npos) == expect);
+
+        expect = do_naive_rfind(text, SIZE_MAX, patt);
+        r = std_string_rfind(text, 0, nullopt, sref(patt));
+        ASTERIA_TEST_CHECK((r ? static_cast<size_t>(*r) : cow_string::npos) == expect);
+
+        // Search from all offsets near the end, which exercises tails.
+        for(size_t from = size - ::std::min<size_t>(size, 40);  from != size;  ++from) {
+          expect = do_naive_find(text, from, patt);
+          r = std_string_find(text, static_cast<int64_t>(from), nullopt, sref(patt));
+          ASTERIA_TEST_CHECK((r ? static_cast<size_t>(*r) : cow_string::npos) == expect);
+
+          expect = do_naive_rfind(text, from, patt);
+          r = std_string_rfind(text, 0, static_cast<int64_t>(from + ::strlen(patt)), sref(patt));
+          ASTERIA_TEST_CHECK((r ? static_cast<size_t>(*r) : cow_string::npos) == expect);
+        }
+      }
+
+      // Character class scanning
+      for(const char* set : s_sets) {
+        size_t expect = do_naive_find_of(text, set, true, false);
+        optV_integer r = std_string_find_any_of(text, 0, nullopt, sref(set));
+        ASTERIA_TEST_CHECK((r ? static_cast<size_t>(*r) : cow_string::npos) == expect);
+
+        expect = do_naive_find_of(text, set, false, false);
+        r = std_string_find_not_of(text, 0, nullopt, sref(set));
+        ASTERIA_TEST_CHECK((r ? static_cast<size_t>(*r) : cow_string::npos) == expect);
+
+        expect = do_naive_find_of(text, set, true, true);
+        r = std_string_rfind_any_of(text, 0, nullopt, sref(set));
+        ASTERIA_TEST_CHECK((r ? static_cast<size_t>(*r) : cow_string::npos) == expect);
+
+        expect = do_naive_find_of(text, set, false, true);
+        r = std_string_rfind_not_of(text, 0, nullopt, sref(set));
+        ASTERIA_TEST_CHECK((r ? static_cast<size_t>(*r) : cow_string::npos) == expect);
+      }
+
+      // Translation
+      cow_string res = std_string_translate(text, sref("aeiou\t"), sref("AEIOU"));
+
+      cow_string expect;
+      for(char c : text)
+        if(c == '\t')
+          continue;
+        else if((c != 0) && ::strchr("aeiou", c))
+          expect.push_back(static_cast<char>(c - 0x20));
+        else
+          expect.push_back(c);
+      ASTERIA_TEST_CHECK(res == expect);
+    }
+  }
+
+}  // namespace
+
+int main()
+  {
+    // Fallback paths shall produce the same results.
+    for(auto level : { cpu_features_all, cpu_features_ssse3, cpu_features_sse2 }) {
+      limit_cpu_features(level);
+      do_check_all();
+    }
+  }
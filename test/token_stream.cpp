@@ -19,8 +19,7 @@ int main()
         .false/*more
         comments*/;/*yet more*/-42e13
       )__"), tinybuf::open_read);
-    ts.reload(sref("dummy_file"), 16, ::std::move(cbuf));
-    ASTERIA_TEST_CHECK(cbuf.getc() == EOF);
+    ts.reload(sref("dummy_file"), 16, cbuf);
 
     auto p = ts.peek_opt();
     ASTERIA_TEST_CHECK(p);
@@ -109,4 +108,20 @@ int main()
 
     p = ts.peek_opt();
     ASTERIA_TEST_CHECK(!p);
+    ASTERIA_TEST_CHECK(cbuf.getc() == EOF);
+
+    // Tokens are read on demand, and lookahead may cross lines.
+    cbuf.set_string(sref("a\n\n  b  // c\nd e"), tinybuf::open_read);
+    ts.reload(sref("dummy_file"), 1, cbuf);
+
+    p = ts.peek_opt(2);
+    ASTERIA_TEST_CHECK(p);
+    ASTERIA_TEST_CHECK(p->as_identifier() == "d");
+    ASTERIA_TEST_CHECK(p->line() == 4);
+    ts.shift(3);
+
+    p = ts.peek_opt();
+    ASTERIA_TEST_CHECK(p);
+    ASTERIA_TEST_CHECK(p->as_identifier() == "e");
+    ASTERIA_TEST_CHECK(!ts.peek_opt(1));
   }
@@ -0,0 +1,115 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/utils.hpp"
+using namespace ::asteria;
+
+// This test compares UTF-8 validation against the scalar decoder, with
+// sequences placed across block boundaries.
+
+namespace {
+
+size_t
+do_naive_valid_prefix(const cow_string& text)
+  {
+    size_t offset = 0;
+    char32_t cp;
+    while((offset < text.size()) && utf8_decode(cp, text, offset));
+    return offset;
+  }
+
+size_t
+do_naive_ascii_prefix(const cow_string& text)
+  {
+    size_t offset = 0;
+    while((offset < text.size()) && (static_cast<uint8_t>(text[offset]) < 0x80))
+      offset ++;
+    return offset;
+  }
+
+size_t
+do_check(const cow_string& text)
+  {
+    // As there are millions of cases, only failures are logged.
+    size_t nfailed = 0;
+    if(utf8_valid_prefix_length(text.data(), text.size()) != do_naive_valid_prefix(text)) {
+      ::fprintf(stderr, "utf8_valid_prefix_length() mismatch: %s\n", text.c_str());
+      nfailed ++;
+    }
+
+    if(ascii_prefix_length(text.data(), text.size()) != do_naive_ascii_prefix(text)) {
+      ::fprintf(stderr, "ascii_prefix_length() mismatch: %s\n", text.c_str());
+      nfailed ++;
+    }
+    return nfailed;
+  }
+
+void
+do_check_all()
+  {
+    // These are interesting bytes around boundaries of byte classes.
+    static constexpr uint8_t s_trails[] =
+      {
+        0x00, 0x41, 0x7F, 0x80, 0x8F, 0x90, 0x9F, 0xA0, 0xBF, 0xC0, 0xF4, 0xFF,
+      };
+
+    size_t nfailed = 0;
+
+    // Put every leading byte, followed by every combination of trailing
+    // bytes, at every offset near the ends of 16-byte and 32-byte blocks.
+    for(uint32_t lead = 0x80;  lead <= 0xFF;  ++lead)
+      for(uint8_t t1 : s_trails)
+        for(uint8_t t2 : s_trails)
+          for(uint8_t t3 : s_trails)
+            for(size_t pos : { 0U, 13U, 14U, 15U, 29U, 30U, 31U, 33U }) {
+              cow_string text(40, 'a');
+              text.mut(pos) = static_cast<char>(lead);
+              text.mut(pos + 1) = static_cast<char>(t1);
+              text.mut(pos + 2) = static_cast<char>(t2);
+              text.mut(pos + 3) = static_cast<char>(t3);
+              nfailed += do_check(text);
+
+              // Truncate it, so the sequence may be incomplete at the end.
+              text.erase(pos + 1 + lead % 3);
+              nfailed += do_check(text);
+            }
+
+    // Check random valid text with some bytes corrupted.
+    static constexpr char s_chars[][5] =
+      {
+        "a", "Z", " ", "\n", "\xC2\xA9", "\xDF\xBF", "\xE4\xB8\xAD", "\xED\x9F\xBF",
+        "\xEE\x80\x80", "\xEF\xBF\xBD", "\xF0\x90\x80\x80", "\xF4\x8F\xBF\xBF",
+      };
+
+    uint32_t seed = 1;
+    for(size_t size = 0;  size != 300;  ++size)
+      for(int round = 0;  round != 8;  ++round) {
+        cow_string text;
+        while(text.size() < size) {
+          seed = seed * 1103515245U + 12345U;
+          text.append(s_chars[(seed >> 16) % (sizeof(s_chars) / sizeof(*s_chars))]);
+        }
+        nfailed += do_check(text);
+
+        if(text.empty())
+          continue;
+
+        seed = seed * 1103515245U + 12345U;
+        text.mut((seed >> 8) % text.size()) = static_cast<char>(seed >> 24);
+        nfailed += do_check(text);
+      }
+
+    ASTERIA_TEST_CHECK(nfailed == 0);
+  }
+
+}  // namespace
+
+int main()
+  {
+    // Fallback paths shall produce the same results.
+    for(auto level : { cpu_features_all, cpu_features_ssse3, cpu_features_sse2 }) {
+      limit_cpu_features(level);
+      do_check_all();
+    }
+  }
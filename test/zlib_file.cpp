@@ -0,0 +1,97 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+using namespace ::asteria;
+
+int main()
+  {
+    Simple_Script code;
+    code.reload_string(
+      sref(__FILE__), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        const chars = "0123456789abcdefghijklmnopqrstuvwxyz";
+        // We presume this random string will never match any real files.
+        var fname = ".zlib_file-test_file_" + std.string.implode(std.array.shuffle(std.string.explode(chars)));
+
+        // Output exceeds the buffer many times.
+        var lines = [];
+        var w = std.zlib.open_gzip_writer(fname, 1);
+        for(var i = 0;  i < 100000;  ++i) {
+          lines[$] = std.string.format("$1 $2\n", i, std.checksum.sha1(std.string.format("$1", i)));
+          w.write(lines[i]);
+        }
+        var w2 = w;
+        w2.flush();
+        w.write("");
+        w2.close();
+        assert catch( w.write("x") ) != null;
+        assert catch( w.close() ) != null;
+
+        var text = std.string.implode(lines);
+        assert std.zlib.gunzip(std.filesystem.file_read(fname)) == text;
+
+        var r = std.zlib.open_gzip_reader(fname);
+        var chunks = [];
+        for(;;) {
+          var s = r.read(7777);
+          if(s == null)
+            break;
+          assert countof s <= 7777;
+          chunks[$] = s;
+        }
+        assert std.string.implode(chunks) == text;
+        assert r.read() == null;
+        r.close();
+        assert catch( r.read() ) != null;
+
+        // multiple members, and data after them
+        std.filesystem.file_write(fname, std.zlib.gzip("hello ") + std.zlib.gzip("world") + "\x00\x00");
+        r = std.zlib.open_gzip_reader(fname);
+        assert r.read() == "hello world";
+        assert r.read() == null;
+        assert catch( r.read(0) ) != null;
+
+        // Only the magic number `1F 8B` starts another member.
+        std.filesystem.file_write(fname, std.zlib.gzip("hello") + "\x1F\x00");
+        r = std.zlib.open_gzip_reader(fname);
+        assert r.read() == "hello";
+        assert r.read() == null;
+
+        // A file that is truncated, empty or not compressed is reported.
+        std.filesystem.file_write(fname, std.string.slice(std.zlib.gzip(text), 0, 100000));
+        r = std.zlib.open_gzip_reader(fname);
+        assert catch( r.read() ) != null;
+
+        std.filesystem.file_write(fname, "");
+        r = std.zlib.open_gzip_reader(fname);
+        assert catch( r.read() ) != null;
+
+        std.filesystem.file_write(fname, "plain text");
+        r = std.zlib.open_gzip_reader(fname);
+        assert catch( r.read() ) != null;
+
+        // A writer that is not closed is finished when destroyed.
+        w = std.zlib.open_gzip_writer(fname);
+        w.write("unclosed");
+        w = null;
+        w2 = null;
+        assert std.zlib.gunzip(std.filesystem.file_read(fname)) == "unclosed";
+
+        // A writer whose final write fails is not finished again.
+        w = std.zlib.open_gzip_writer("/dev/full");
+        w.write("full");
+        assert catch( w.close() ) != null;
+        assert catch( w.close() ) != null;
+        w = null;
+
+        std.filesystem.file_remove(fname);
+        assert catch( std.zlib.open_gzip_reader(fname) ) != null;
+        assert catch( std.zlib.open_gzip_writer("/nonexistent/" + fname) ) != null;
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+    code.execute();
+  }
@@ -0,0 +1,73 @@
+// This file is part of Asteria.
+// Copyleft 2018 - 2023, LH_Mouse. All wrongs reserved.
+
+#include "utils.hpp"
+#include "../asteria/simple_script.hpp"
+using namespace ::asteria;
+
+int main()
+  {
+    Simple_Script code;
+    code.reload_string(
+      sref(__FILE__), __LINE__, sref(R"__(
+///////////////////////////////////////////////////////////////////////////////
+
+        var lines = [];
+        for(var i = 0;  i < 80000;  ++i)
+          lines[$] = std.string.format("$1 GET /index.html?id=$2 200\n", i, i * 7919 % 100003);
+        var text = std.string.implode(lines);
+        assert countof text > 0x200000;
+
+        // Data that are compressed in blocks can be decompressed as a single
+        // stream, and are almost as small.
+        for(var level = 0;  level <= 9;  level += 3) {
+          var single = std.zlib.gzip(text, level);
+          var multi = std.zlib.gzip(text, level, 4);
+          assert std.zlib.gunzip(multi) == text;
+          assert countof multi <= countof single * 1.01 + 64;
+
+          single = std.zlib.deflate(text, level);
+          multi = std.zlib.deflate(text, level, 4);
+          assert std.zlib.inflate(multi) == text;
+          assert countof multi <= countof single * 1.01 + 64;
+        }
+        assert std.zlib.gunzip(std.zlib.gzip(text, null, 0)) == text;
+        assert std.zlib.gunzip(std.zlib.gzip("short", null, 8)) == "short";
+        assert catch( std.zlib.gzip(text, null, -1) ) != null;
+
+        // multiple members
+        var first = std.zlib.gzip("hello ");
+        var second = std.zlib.gzip(text, null, 3);
+        assert std.zlib.gunzip(first + second) == "hello " + text;
+        assert std.zlib.gunzip(first + second, 4) == "hello " + text;
+        assert std.zlib.gunzip(first + "\x00\x00") == "hello ";
+        assert catch( std.zlib.gunzip(first + std.string.slice(second, 0, 100)) ) != null;
+
+        // members with sizes in extra fields, which are decompressed in
+        // parallel
+        func bgzf(data) {
+          var defl = std.zlib.Deflator("raw");
+          defl.update(data);
+          var body = defl.finish();
+          return "\x1F\x8B\x08\x04\x00\x00\x00\x00\x00\xFF\x06\x00BC\x02\x00" +
+                 std.numeric.pack_i16le([ 25 + countof body ]) + body +
+                 std.numeric.pack_i32le([ std.checksum.crc32(data), countof data ]);
+        }
+
+        var members = [];
+        for(var k = 0;  k < countof text;  k += 50000)
+          members[$] = bgzf(std.string.slice(text, k, 50000));
+        members[$] = bgzf("");
+        var packed = std.string.implode(members);
+        assert std.zlib.gunzip(packed, 4) == text;
+        assert std.zlib.gunzip(packed) == text;
+
+        // A corrupt member is reported.
+        members[3] = std.string.slice(members[3], 0, countof members[3] - 1) + "\x7F";
+        assert catch( std.zlib.gunzip(std.string.implode(members), 4) ) != null;
+        assert catch( std.zlib.gunzip(std.string.implode(members)) ) != null;
+
+///////////////////////////////////////////////////////////////////////////////
+      )__"));
+    code.execute();
+  }